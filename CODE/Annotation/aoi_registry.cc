@@ -0,0 +1,240 @@
+#include "aoi_registry.h"
+
+#include <algorithm>
+
+namespace sample {
+
+constexpr std::int64_t AoiRegistry::kDefaultDwellMs;
+constexpr int AoiRegistry::kDefaultCellSize;
+constexpr int AoiRegistry::kMaxCells;
+
+// **Batch 클래스**
+void AoiRegistry::Batch::set(Id id, const cv::Rect& rect, std::int64_t dwell_ms) {
+  Op op;
+  op.region.id = id;
+  op.region.rect = rect;
+  op.region.dwell_ms = dwell_ms;
+  ops_.push_back(op);
+}
+
+void AoiRegistry::Batch::remove(Id id) {
+  Op op;
+  op.remove = true;
+  op.region.id = id;
+  ops_.push_back(op);
+}
+
+void AoiRegistry::Batch::clear() {
+  ops_.clear();
+  clear_ = true;
+}
+
+// **AoiRegistry 클래스**
+AoiRegistry::AoiRegistry(int cell_size)
+: cell_size_(std::max(cell_size, 1)) {}
+
+void AoiRegistry::commit(const Batch& batch) {
+  if (batch.empty())
+    return;
+
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (batch.clear_)
+    regions_.clear();
+
+  for (const auto& op : batch.ops_) {
+    const auto it = std::lower_bound(regions_.begin(), regions_.end(), op.region.id,
+                                     [](const Region& r, Id id) { return r.id < id; });
+    const bool found = it != regions_.end() && it->id == op.region.id;
+    if (op.remove) {
+      if (found)
+        regions_.erase(it);
+    } else if (found) {
+      *it = op.region;
+    } else {
+      regions_.insert(it, op.region);
+    }
+  }
+
+  // 작성자 슬롯(back)에는 이전에 공개한 색인이 남아 있으므로 배열 용량을 재사용하여 다시 만듦
+  build(&index_.back());
+  index_.publish();
+  commits_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t AoiRegistry::size() const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  return regions_.size();
+}
+
+// 이전 시선에서 안에 있던 영역(inside_)과 이번 시선의 영역(hits_)을 id 순으로 맞춰 보며
+// 나온 영역 → 들어간 영역 → 머무름 순으로 신호 발행
+void AoiRegistry::process(const GazeSample& sample) {
+  index_.acquire(); // 새 색인이 있으면 가져옴
+  const auto& index = index_.front();
+
+  hits_.clear();
+  if (sample.valid)
+    candidates_.fetch_add(find(index, sample.x, sample.y, &hits_), std::memory_order_relaxed);
+  samples_.fetch_add(1, std::memory_order_relaxed);
+
+  const auto now = sample.timestamp;
+  const auto elapsed = [now](const Inside& inside) {
+    return now > inside.enter_time ? static_cast<std::int64_t>(now - inside.enter_time) : std::int64_t{0};
+  };
+
+  next_.clear();
+  entered_.clear();
+  std::size_t i = 0;
+  std::size_t j = 0;
+  while (i < inside_.size() || j < hits_.size()) {
+    const Region* hit = j < hits_.size() ? &index.regions[hits_[j]] : nullptr;
+    if (hit == nullptr || (i < inside_.size() && inside_[i].id < hit->id)) {
+      on_leave_(inside_[i].id, now, elapsed(inside_[i]));
+      leaves_.fetch_add(1, std::memory_order_relaxed);
+      ++i;
+    } else if (i == inside_.size() || hit->id < inside_[i].id) {
+      Inside inside;
+      inside.id = hit->id;
+      inside.enter_time = now;
+      inside.dwell_ms = hit->dwell_ms;
+      entered_.push_back(next_.size());
+      next_.push_back(inside);
+      ++j;
+    } else {
+      next_.push_back(inside_[i]);
+      next_.back().dwell_ms = hit->dwell_ms; // 영역이 교체되었을 수 있음
+      ++i;
+      ++j;
+    }
+  }
+
+  for (const auto k : entered_) {
+    on_enter_(next_[k].id, now);
+    enters_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  for (auto& inside : next_) {
+    if (inside.dwell_sent || inside.dwell_ms <= 0)
+      continue;
+    const auto dwell = elapsed(inside);
+    if (dwell >= inside.dwell_ms) {
+      inside.dwell_sent = true;
+      on_dwell_(inside.id, now, dwell);
+      dwells_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  inside_.swap(next_);
+}
+
+std::size_t AoiRegistry::hit_test(float x, float y, std::vector<Id>* ids) {
+  index_.acquire();
+  const auto& index = index_.front();
+
+  hits_.clear();
+  find(index, x, y, &hits_);
+  for (const auto k : hits_)
+    ids->push_back(index.regions[k].id);
+  return hits_.size();
+}
+
+AoiRegistry::Stats AoiRegistry::stats() const {
+  Stats stats;
+  stats.samples = samples_.load(std::memory_order_relaxed);
+  stats.candidates = candidates_.load(std::memory_order_relaxed);
+  stats.enters = enters_.load(std::memory_order_relaxed);
+  stats.leaves = leaves_.load(std::memory_order_relaxed);
+  stats.dwells = dwells_.load(std::memory_order_relaxed);
+  stats.commits = commits_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 모든 영역을 포함하는 범위를 칸으로 나누고, 칸마다 걸친 영역 목록을 만듦
+// - 영역을 id 순으로 넣으므로 칸별 목록도 id 순
+void AoiRegistry::build(Index* index) const {
+  index->regions = regions_;
+  index->extent = cv::Rect();
+  for (const auto& region : regions_) {
+    if (!region.rect.empty())
+      index->extent |= region.rect;
+  }
+
+  index->cell_start.clear();
+  index->cell_items.clear();
+  if (index->extent.empty()) {
+    index->cols = index->rows = 0;
+    return;
+  }
+
+  const auto& extent = index->extent;
+  int cell = cell_size_;
+  while (static_cast<std::int64_t>((extent.width + cell - 1) / cell) * ((extent.height + cell - 1) / cell) > kMaxCells)
+    cell *= 2;
+  index->cell = cell;
+  index->cols = (extent.width + cell - 1) / cell;
+  index->rows = (extent.height + cell - 1) / cell;
+
+  // 영역이 걸친 칸 범위
+  const auto cells_of = [&](const cv::Rect& rect, int* cx0, int* cy0, int* cx1, int* cy1) {
+    *cx0 = (rect.x - extent.x) / cell;
+    *cy0 = (rect.y - extent.y) / cell;
+    *cx1 = (rect.x + rect.width - 1 - extent.x) / cell;
+    *cy1 = (rect.y + rect.height - 1 - extent.y) / cell;
+  };
+
+  // 1. 칸별 영역 수 세기
+  index->cell_start.assign(static_cast<std::size_t>(index->cols) * index->rows + 1, 0);
+  for (const auto& region : regions_) {
+    if (region.rect.empty())
+      continue;
+    int cx0, cy0, cx1, cy1;
+    cells_of(region.rect, &cx0, &cy0, &cx1, &cy1);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+      for (int cx = cx0; cx <= cx1; ++cx)
+        ++index->cell_start[cy * index->cols + cx + 1];
+    }
+  }
+  for (std::size_t c = 1; c < index->cell_start.size(); ++c)
+    index->cell_start[c] += index->cell_start[c - 1];
+
+  // 2. 칸별 목록 채우기
+  std::vector<std::uint32_t> cursor(index->cell_start.begin(), index->cell_start.end() - 1);
+  index->cell_items.resize(index->cell_start.back());
+  for (std::uint32_t k = 0; k < regions_.size(); ++k) {
+    const auto& rect = regions_[k].rect;
+    if (rect.empty())
+      continue;
+    int cx0, cy0, cx1, cy1;
+    cells_of(rect, &cx0, &cy0, &cx1, &cy1);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+      for (int cx = cx0; cx <= cx1; ++cx)
+        index->cell_items[cursor[cy * index->cols + cx]++] = k;
+    }
+  }
+}
+
+std::size_t AoiRegistry::find(const Index& index, float x, float y, std::vector<std::uint32_t>* hits) {
+  if (index.cols == 0)
+    return 0;
+
+  const float lx = x - static_cast<float>(index.extent.x);
+  const float ly = y - static_cast<float>(index.extent.y);
+  if (lx < 0.f || ly < 0.f || lx >= index.extent.width || ly >= index.extent.height)
+    return 0;
+  const int cx = static_cast<int>(lx) / index.cell;
+  const int cy = static_cast<int>(ly) / index.cell;
+  if (cx >= index.cols || cy >= index.rows)
+    return 0;
+
+  const auto c = static_cast<std::size_t>(cy) * index.cols + cx;
+  const auto begin = index.cell_start[c];
+  const auto end = index.cell_start[c + 1];
+  for (auto k = begin; k < end; ++k) {
+    const auto& rect = index.regions[index.cell_items[k]].rect;
+    if (x >= rect.x && y >= rect.y && x < rect.x + rect.width && y < rect.y + rect.height)
+      hits->push_back(index.cell_items[k]);
+  }
+  return end - begin;
+}
+
+} // namespace sample
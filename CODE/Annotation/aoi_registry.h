@@ -0,0 +1,170 @@
+#ifndef EYEDID_CPP_SAMPLE_AOI_REGISTRY_H_
+#define EYEDID_CPP_SAMPLE_AOI_REGISTRY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+#include "gaze_sample.h"
+#include "simple_signal.h"
+#include "triple_buffer.h"
+
+namespace sample {
+
+/**
+ * AoiRegistry 클래스:
+ * - 관심 영역(AOI, area of interest)을 등록하고 시선마다 어느 영역 안에 있는지 판정
+ * - 영역에 들어가거나(on_enter_) 나오거나(on_leave_) 일정 시간 머무르면(on_dwell_) 신호를 발행
+ *   (구독하는 쪽에서 영역 목록을 매번 훑지 않아도 됨)
+ * - 영역은 균일 격자 색인으로 찾음: 시선이 속한 칸에 걸친 영역만 검사
+ *   (영역 수와 관계없이 칸 하나의 영역 수만큼만 검사)
+ * - 영역 변경은 Batch로 모아 commit() 한 번에 색인을 다시 만들고, 판정하는 쪽에 잠금 없이 전달 (TripleBuffer)
+ * - commit()은 어느 스레드에서나 호출 가능, process()/hit_test()는 한 스레드(SDK 콜백 스레드)에서만 호출해야 함
+ * - 신호는 process()를 호출한 스레드에서 발행
+ */
+class AoiRegistry {
+ public:
+  using Id = std::uint32_t;
+
+  static constexpr std::int64_t kDefaultDwellMs = 500; // 기본 머무름 판정 시간 (ms)
+  static constexpr int kDefaultCellSize = 64;          // 기본 색인 칸 크기 (픽셀)
+
+  // 관심 영역
+  struct Region {
+    Id id = 0;
+    cv::Rect rect;                           // 영역 (창 기준 픽셀)
+    std::int64_t dwell_ms = kDefaultDwellMs; // 이 시간 이상 머무르면 on_dwell_ 발행 (0 이하이면 발행하지 않음)
+  };
+
+  // 영역 변경 묶음
+  class Batch {
+   public:
+    // 영역 추가 (같은 id가 있으면 교체)
+    void set(Id id, const cv::Rect& rect, std::int64_t dwell_ms = kDefaultDwellMs);
+    void remove(Id id);
+    void clear(); // 기존 영역을 모두 지움 (이 호출 이전에 추가한 변경도 지움)
+    bool empty() const { return !clear_ && ops_.empty(); }
+
+   private:
+    friend class AoiRegistry;
+    struct Op {
+      bool remove = false;
+      Region region;
+    };
+    std::vector<Op> ops_;
+    bool clear_ = false;
+  };
+
+  // 판정 통계
+  struct Stats {
+    std::uint64_t samples = 0;    // 판정한 시선 수
+    std::uint64_t candidates = 0; // 검사한 영역 수 합계 (samples로 나누면 시선당 검사 수)
+    std::uint64_t enters = 0;
+    std::uint64_t leaves = 0;
+    std::uint64_t dwells = 0;
+    std::uint64_t commits = 0;    // 색인을 다시 만든 횟수
+  };
+
+  /**
+   * @param cell_size 색인 칸 크기 (픽셀, 영역 범위가 너무 넓으면 칸 수가 제한을 넘지 않도록 키움)
+   */
+  explicit AoiRegistry(int cell_size = kDefaultCellSize);
+
+  AoiRegistry(const AoiRegistry&) = delete;
+  AoiRegistry& operator=(const AoiRegistry&) = delete;
+
+  /**
+   * 변경 묶음 적용 (색인을 한 번만 다시 만듦)
+   * - 판정하는 쪽은 다음 process()부터 새 색인을 사용
+   * - 사라진 영역 안에 있던 시선은 다음 process()에서 on_leave_로 알림
+   */
+  void commit(const Batch& batch);
+
+  // 변경 함수 func(Batch&)를 호출한 뒤 commit()
+  template<typename F>
+  void update(F&& func) {
+    Batch batch;
+    func(batch);
+    commit(batch);
+  }
+
+  // 등록된 영역 수
+  std::size_t size() const;
+
+  /**
+   * 시선 하나를 판정하고 들어감/나옴/머무름 신호 발행
+   * - 유효하지 않은 시선이면 모든 영역에서 나온 것으로 처리
+   */
+  void process(const GazeSample& sample);
+
+  /**
+   * 좌표를 포함하는 영역 id (id 순)
+   * @return 찾은 영역 수
+   */
+  std::size_t hit_test(float x, float y, std::vector<Id>* ids);
+
+  Stats stats() const;
+
+  // ==== 신호(signal) 정의 (process()를 호출한 스레드에서 발행) ====
+
+  // 영역에 들어감 (영역 id, 타임스탬프)
+  signal<void(Id, std::uint64_t)> on_enter_;
+
+  // 영역에서 나옴 (영역 id, 타임스탬프, 머문 시간 ms)
+  signal<void(Id, std::uint64_t, std::int64_t)> on_leave_;
+
+  // 영역에 dwell_ms 이상 머무름, 들어갈 때마다 한 번 (영역 id, 타임스탬프, 머문 시간 ms)
+  signal<void(Id, std::uint64_t, std::int64_t)> on_dwell_;
+
+ private:
+  static constexpr int kMaxCells = 1 << 16; // 색인 칸 수 제한
+
+  // 공간 색인 (칸별 영역 목록을 연속 배열에 저장)
+  struct Index {
+    std::vector<Region> regions;              // id 순
+    cv::Rect extent;                          // 색인 범위 (모든 영역을 포함)
+    int cell = 0;
+    int cols = 0;
+    int rows = 0;
+    std::vector<std::uint32_t> cell_start;    // 칸 i의 영역은 cell_items[cell_start[i] ~ cell_start[i + 1])
+    std::vector<std::uint32_t> cell_items;    // regions 위치 (칸마다 id 순)
+  };
+
+  // 영역 안에 있는 동안의 상태
+  struct Inside {
+    Id id = 0;
+    std::uint64_t enter_time = 0;
+    std::int64_t dwell_ms = 0;
+    bool dwell_sent = false;
+  };
+
+  void build(Index* index) const; // regions_로 색인 만들기 (mutex_를 잡은 상태에서 호출)
+  // 좌표를 포함하는 영역의 regions 위치를 hits에 추가, 검사한 영역 수 반환
+  static std::size_t find(const Index& index, float x, float y, std::vector<std::uint32_t>* hits);
+
+  // 작성자 (commit)
+  mutable std::mutex mutex_;
+  std::vector<Region> regions_; // id 순
+  int cell_size_;
+  TripleBuffer<Index> index_;
+
+  // 판정 스레드 전용
+  std::vector<std::uint32_t> hits_;
+  std::vector<Inside> inside_;  // id 순
+  std::vector<Inside> next_;
+  std::vector<std::size_t> entered_; // 이번 시선에서 들어간 영역 (next_ 위치)
+
+  std::atomic<std::uint64_t> samples_{0};
+  std::atomic<std::uint64_t> candidates_{0};
+  std::atomic<std::uint64_t> enters_{0};
+  std::atomic<std::uint64_t> leaves_{0};
+  std::atomic<std::uint64_t> dwells_{0};
+  std::atomic<std::uint64_t> commits_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_AOI_REGISTRY_H_
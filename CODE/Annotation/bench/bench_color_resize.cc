@@ -0,0 +1,66 @@
+/**
+ * BgrToRgbResizer와 cv::cvtColor + cv::resize 비교 (프레임당 시간, 결과 차이)
+ * - 카메라 해상도별로 SDK 입력 크기(640x480 등)까지 변환
+ * - 결과 차이는 채널별 최대 절댓값 차이 (bilinear 반올림 차이로 1 이하여야 함)
+ *
+ * 사용법: bench_color_resize [iterations=500]
+ * 빌드: color_resize.cc
+ *   g++ -std=c++14 -O2 -pthread -I.. bench_color_resize.cc ../color_resize.cc $(pkg-config --cflags --libs opencv4)
+ *
+ * 결과: 아직 없음 (실제 OpenCV가 있는 환경에서 측정하여 기록해야 함)
+ *   한 줄에 변경 전(cvtColor+resize=)과 변경 후(fused=) 시간이 함께 나오므로 그 줄을 그대로 옮겨 적음
+ */
+
+#include <cstdio>
+
+#include "bench_util.h"
+#include "color_resize.h"
+#include "opencv2/opencv.hpp"
+
+using namespace sample;
+
+namespace {
+
+void run(cv::Size src_size, cv::Size dst_size, long iterations) {
+  cv::Mat src(src_size, CV_8UC3);
+  cv::randu(src, cv::Scalar::all(0), cv::Scalar::all(256));
+
+  // 기존 방식: 채널 변환 후 크기 조정 (프레임을 두 번 읽음)
+  cv::Mat rgb, expected;
+  auto start = bench::clock::now();
+  for (long i = 0; i < iterations; ++i) {
+    cv::cvtColor(src, rgb, cv::COLOR_BGR2RGB);
+    if (dst_size != src_size)
+      cv::resize(rgb, expected, dst_size, 0, 0, cv::INTER_LINEAR);
+    else
+      expected = rgb;
+  }
+  const auto opencv_ns = bench::elapsed_ns(start) / iterations;
+
+  BgrToRgbResizer resizer(dst_size);
+  cv::Mat actual;
+  start = bench::clock::now();
+  for (long i = 0; i < iterations; ++i)
+    resizer.convert(src, &actual);
+  const auto fused_ns = bench::elapsed_ns(start) / iterations;
+
+  const auto max_diff = actual.size() == expected.size() ? cv::norm(actual, expected, cv::NORM_INF) : -1.0;
+
+  std::printf("%dx%d -> %dx%d cvtColor+resize=%.1fus fused=%.1fus speedup=%.2fx max_diff=%.0f\n",
+              src_size.width, src_size.height, dst_size.width, dst_size.height,
+              opencv_ns / 1e3, fused_ns / 1e3,
+              fused_ns > 0 ? static_cast<double>(opencv_ns) / static_cast<double>(fused_ns) : 0.0, max_diff);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto iterations = bench::arg(argc, argv, 1, 500);
+
+  std::printf("simd=%s iterations=%ld\n", BgrToRgbResizer::simd_path(), iterations);
+  run(cv::Size(640, 480), cv::Size(640, 480), iterations);   // 채널 변환만
+  run(cv::Size(1280, 720), cv::Size(640, 480), iterations);
+  run(cv::Size(1280, 720), cv::Size(640, 360), iterations);
+  run(cv::Size(1920, 1080), cv::Size(640, 480), iterations);
+  return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * 시선 필터 비교: 시선 하나당 필터 비용과, 기록된 시선을 재생했을 때 화면 표시 시각의 실제 시선과의 오차
+ * - 합성 시선: 고정(fixation) → 도약(saccade) 또는 추적(pursuit)을 반복하고, 측정값에 가우시안 잡음을 더함
+ * - 비용: 필터를 직접 호출할 때와 GazeFilter(TrackerManager::setGazeFilter에 넘기는 단계)로 호출할 때 (ns/sample)
+ * - 재생: 합성 시선을 GazeLogWriter로 기록한 뒤 GazeReplayer::make_tracker()로 초기화한 TrackerManager에
+ *   필터를 설정하고, on_gaze_ 좌표와 lead_ms 뒤의 실제 시선을 비교 (움직임 종류별 RMS 오차, px)
+ *   fixation은 고정이 시작되고 150ms 뒤부터의 떨림, settle은 도약 직후를 포함한 고정 전체의 오차
+ *
+ * 사용법: bench_gaze_filter [hz=30] [lead_ms=50] [noise_px=15] [log_path=/tmp/bench_gaze_filter.eygl]
+ * 빌드: gaze_log.cc gaze_replayer.cc tracker_manager.cc frame_tracker.cc aoi_registry.cc telemetry.cc
+ *       latency_trace.cc window_geometry.cc executor.cc
+ *   g++ -std=c++14 -O2 -pthread -I.. -I<eyedid SDK>/include bench_gaze_filter.cc ../gaze_log.cc ../gaze_replayer.cc
+ *       ../tracker_manager.cc ../frame_tracker.cc ../aoi_registry.cc ../telemetry.cc ../latency_trace.cc
+ *       ../window_geometry.cc ../executor.cc $(pkg-config --cflags --libs opencv4) -L<eyedid SDK>/lib -leyedid
+ *
+ * 결과 (Xeon 1코어 VM, g++ 12.2 -O2, hz=30 lead_ms=50 noise_px=15): raw가 변경 전(필터 없음)
+ *   비용 (GazeFilter 단계, ns/sample): raw=3.0 one-euro=39.3 kalman=20.8 one-euro+predict=41.6
+ *     one-euro+predict live=98.2 (시선마다 steady_clock을 읽음, 이 VM에서는 시계 읽기가 느림)
+ *   재생 오차 (RMS, px)      fixation  settle  saccade  pursuit
+ *     raw                     21.2      95.3    497.7     34.6
+ *     one-euro                13.5     114.0    513.4     41.8
+ *     kalman                  18.0     115.3    507.8     32.8
+ *     one-euro+predict        19.6     114.5    513.1     27.7
+ *     kalman+predict          26.4     116.5    507.2     27.3
+ *   (필터 계산은 cv::Point2f만 쓰므로 OpenCV 구현과 무관)
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "gaze_filter.h"
+#include "gaze_log.h"
+#include "gaze_replayer.h"
+#include "tracker_manager.h"
+
+using namespace sample;
+
+namespace {
+
+enum Motion { kFixation = 0, kSaccade = 1, kPursuit = 2, kMotionCount = 3 };
+const char* const kMotionNames[kMotionCount] = { "settle", "saccade", "pursuit" };
+constexpr double kSettledMs = 150.0; // 고정이 시작되고 이 시간이 지나면 떨림만 남은 것으로 봄
+
+struct Segment {
+  double begin_ms, end_ms;
+  cv::Point2f from, to;
+  Motion motion;
+};
+
+struct Sample {
+  std::uint64_t timestamp; // ms
+  cv::Point2f measured;    // 잡음이 섞인 측정값
+  cv::Point2f displayed;   // timestamp + lead_ms의 실제 시선 (필터 출력이 맞춰야 할 값)
+  Motion motion;           // timestamp + lead_ms의 움직임 종류
+  double since_ms;         // timestamp + lead_ms에 해당 움직임이 시작된 뒤 지난 시간
+};
+
+// 약 2분 길이의 합성 시선 (seed가 같으면 항상 같은 결과)
+std::vector<Sample> make_samples(long hz, double lead_ms, double noise_px) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> ux(100.f, 1800.f), uy(100.f, 1000.f), unit(0.f, 1.f);
+  std::uniform_real_distribution<double> fixation_ms(200.0, 500.0);
+  std::normal_distribution<float> noise(0.f, static_cast<float>(noise_px));
+
+  constexpr double kDurationMs = 120000.0;
+  std::vector<Segment> segments;
+  cv::Point2f p(960.f, 540.f);
+  for (double t = 0.0; t < kDurationMs + lead_ms + 1000.0;) {
+    const double fixation = fixation_ms(rng);
+    segments.push_back({ t, t + fixation, p, p, kFixation });
+    t += fixation;
+
+    const cv::Point2f q(ux(rng), uy(rng));
+    const double distance = std::hypot(q.x - p.x, q.y - p.y);
+    const bool pursuit = unit(rng) < 0.3f;
+    const double duration = pursuit ? distance / (300.0 + 600.0 * unit(rng)) * 1000.0 : 30.0 + 0.05 * distance;
+    segments.push_back({ t, t + duration, p, q, pursuit ? kPursuit : kSaccade });
+    t += duration;
+    p = q;
+  }
+
+  std::size_t k = 0;
+  const auto at = [&](double t, Motion* motion, double* since_ms) {
+    while (segments[k].end_ms <= t)
+      ++k;
+    const auto& s = segments[k];
+    auto u = static_cast<float>((t - s.begin_ms) / (s.end_ms - s.begin_ms));
+    if (s.motion == kSaccade)
+      u = u * u * u * (10.f - 15.f * u + 6.f * u * u); // 도약은 빠르게 가속했다 감속 (minimum jerk)
+    *motion = s.motion;
+    *since_ms = t - s.begin_ms;
+    return cv::Point2f(s.from.x + (s.to.x - s.from.x) * u, s.from.y + (s.to.y - s.from.y) * u);
+  };
+
+  std::vector<Sample> samples;
+  const double interval_ms = 1000.0 / static_cast<double>(hz);
+  for (double t = 0.0; t < kDurationMs; t += interval_ms) {
+    Sample sample;
+    sample.timestamp = static_cast<std::uint64_t>(t);
+    Motion motion;
+    double since_ms;
+    const auto truth = at(t, &motion, &since_ms);
+    sample.measured = cv::Point2f(truth.x + noise(rng), truth.y + noise(rng));
+    sample.displayed = at(t + lead_ms, &sample.motion, &sample.since_ms);
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+// 필터를 직접 호출할 때와 GazeFilter로 호출할 때의 시선 하나당 비용 (ns)
+template<typename F>
+void measure_cost(const char* name, const F& filter, const std::vector<Sample>& samples) {
+  constexpr int kRounds = 50;
+  const std::uint64_t round_ms = samples.back().timestamp + 1000; // 라운드마다 타임스탬프가 계속 증가하도록
+
+  F direct = filter;
+  float sum = 0.f;
+  auto start = bench::clock::now();
+  for (int round = 0; round < kRounds; ++round) {
+    direct.reset();
+    for (const auto& s : samples)
+      sum += direct(s.timestamp + round * round_ms, s.measured).x;
+  }
+  const auto direct_ns = static_cast<double>(bench::elapsed_ns(start)) / (kRounds * samples.size());
+
+  auto stage = make_gaze_filter(filter);
+  start = bench::clock::now();
+  for (int round = 0; round < kRounds; ++round) {
+    stage->reset();
+    for (const auto& s : samples)
+      sum += stage->apply(s.timestamp + round * round_ms, s.measured).x;
+  }
+  const auto stage_ns = static_cast<double>(bench::elapsed_ns(start)) / (kRounds * samples.size());
+  bench::keep(sum);
+
+  std::printf("cost %-22s direct=%.1fns/sample stage=%.1fns/sample\n", name, direct_ns, stage_ns);
+}
+
+// 기록된 시선을 TrackerManager로 재생하여 필터를 거친 on_gaze_ 좌표의 오차 측정
+void measure_replay(const char* name, std::unique_ptr<GazeFilter> filter, const GazeLogReader& reader,
+                    const std::vector<Sample>& samples) {
+  GazeReplayer replayer(reader);
+  auto tracker = std::make_shared<TrackerManager>();
+  if (!tracker->initialize(replayer.make_tracker())) {
+    std::printf("replay %-20s failed to initialize\n", name);
+    return;
+  }
+  tracker->setGazeFilter(std::move(filter));
+
+  std::vector<cv::Point2f> output;
+  output.reserve(samples.size());
+  tracker->on_gaze_.connect([&output](int x, int y, bool valid) {
+    if (valid)
+      output.emplace_back(static_cast<float>(x), static_cast<float>(y));
+  });
+  replayer.start(0.0); // 기다리지 않고 최대한 빠르게
+  replayer.join();
+
+  double squared[kMotionCount] = {};
+  std::size_t count[kMotionCount] = {};
+  double fixation_squared = 0.0;
+  std::size_t fixation_count = 0;
+  for (std::size_t i = 0; i < output.size() && i < samples.size(); ++i) {
+    const auto& s = samples[i];
+    const double dx = output[i].x - s.displayed.x;
+    const double dy = output[i].y - s.displayed.y;
+    squared[s.motion] += dx * dx + dy * dy;
+    ++count[s.motion];
+    if (s.motion == kFixation && s.since_ms >= kSettledMs) {
+      fixation_squared += dx * dx + dy * dy;
+      ++fixation_count;
+    }
+  }
+
+  std::printf("replay %-20s samples=%zu fixation=%.1fpx", name, output.size(),
+              fixation_count != 0 ? std::sqrt(fixation_squared / fixation_count) : 0.0);
+  for (int m = 0; m < kMotionCount; ++m)
+    std::printf(" %s=%.1fpx", kMotionNames[m], count[m] != 0 ? std::sqrt(squared[m] / count[m]) : 0.0);
+  std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto hz = bench::arg(argc, argv, 1, 30);
+  const auto lead_ms = static_cast<float>(bench::arg(argc, argv, 2, 50));
+  const auto noise_px = static_cast<double>(bench::arg(argc, argv, 3, 15));
+  const std::string path = argc > 4 ? argv[4] : "/tmp/bench_gaze_filter.eygl";
+
+  const auto samples = make_samples(hz, lead_ms, noise_px);
+  std::printf("hz=%ld lead_ms=%.0f noise_px=%.0f samples=%zu\n", hz, lead_ms, noise_px, samples.size());
+
+  KalmanFilter kalman_lead;
+  kalman_lead.lead_ms = lead_ms;
+  // 합성/재생 타임스탬프는 현재 시각과 무관하므로 예측 시간을 lead_ms로 고정 (live = false)
+  ConstantVelocityPredictor<> predictor;
+  predictor.live = false;
+  predictor.present_delay_ms = lead_ms;
+  ConstantVelocityPredictor<KalmanFilter> kalman_predictor;
+  kalman_predictor.live = false;
+  kalman_predictor.present_delay_ms = lead_ms;
+  ConstantVelocityPredictor<> live_predictor; // 시선마다 steady_clock을 읽는 비용 (비용 측정만)
+
+  measure_cost("raw", PassThroughFilter(), samples);
+  measure_cost("one-euro", OneEuroFilter(), samples);
+  measure_cost("kalman", KalmanFilter(), samples);
+  measure_cost("kalman lead", kalman_lead, samples);
+  measure_cost("one-euro+predict", predictor, samples);
+  measure_cost("one-euro+predict live", live_predictor, samples);
+  measure_cost("kalman+predict", kalman_predictor, samples);
+
+  // 재생용 기록 (레코드 시각 = 타임스탬프)
+  {
+    GazeLogWriter writer;
+    if (!writer.open(path)) {
+      std::printf("failed to open %s\n", path.c_str());
+      return 1;
+    }
+    for (const auto& s : samples) {
+      GazeLogMetrics metrics;
+      metrics.timestamp = s.timestamp;
+      metrics.gaze.x = s.measured.x;
+      metrics.gaze.y = s.measured.y;
+      metrics.gaze.tracking_state = kEyedidTrackingSuccess;
+      writer.write_metrics(static_cast<std::int64_t>(s.timestamp) * 1000000, metrics);
+    }
+    if (!writer.close()) {
+      std::printf("failed to write %s\n", path.c_str());
+      return 1;
+    }
+  }
+
+  GazeLogReader reader;
+  if (!reader.open(path)) {
+    std::printf("failed to read %s\n", path.c_str());
+    return 1;
+  }
+  measure_replay("raw", nullptr, reader, samples);
+  measure_replay("one-euro", make_gaze_filter(OneEuroFilter()), reader, samples);
+  measure_replay("kalman", make_gaze_filter(KalmanFilter()), reader, samples);
+  measure_replay("kalman lead", make_gaze_filter(kalman_lead), reader, samples);
+  measure_replay("one-euro+predict", make_gaze_filter(predictor), reader, samples);
+  measure_replay("kalman+predict", make_gaze_filter(kalman_predictor), reader, samples);
+  return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * CaptureManager 처리량: 카메라 수에 따라 전체 캡처/전달 속도가 늘어나는지 측정
+ * - SDK 없이 SyntheticFrameSource(카메라)와 StubGazeTracker(프레임당 work_us만큼 CPU 사용)로 파이프라인을 만듦
+ * - 카메라를 1대부터 max_cameras대까지 늘리며 전체 fps, 가장 느린 카메라의 fps, SDK 전달 fps를 출력
+ * - pin=1이면 Options::pin_threads를 켬 (코어가 모자란 파이프라인은 고정하지 않고 core=-1로 표시)
+ *
+ * 사용법: bench_multi_camera [max_cameras=코어 수] [fps=30] [work_us=3000] [seconds=3] [pin=0]
+ *         (fps=0이면 소스가 속도를 제한하지 않으므로 카메라 스레드 자체의 최대 처리량을 잼, work_us<0이면 트래커 없이 캡처만)
+ * 빌드: capture_manager.cc camera_thread.cc tracker_feed.cc frame_source.cc frame_pool.cc frame_ring.cc
+ *       frame_aligner.cc color_resize.cc thread_affinity.cc latency_trace.cc tracker_manager.cc frame_tracker.cc
+ *       telemetry.cc executor.cc aoi_registry.cc window_geometry.cc
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+#include "bench_util.h"
+#include "capture_manager.h"
+#include "frame_source.h"
+#include "frame_tracker.h"
+#include "thread_affinity.h"
+#include "tracker_manager.h"
+
+using namespace sample;
+
+namespace {
+
+void run(std::size_t cameras, double fps, long work_us, long seconds, bool pin) {
+  CaptureManager::Options options;
+  options.pin_threads = pin;
+  CaptureManager manager(options);
+
+  StubGazeTracker::Options tracker_options;
+  tracker_options.work = std::chrono::microseconds(work_us);
+  for (std::size_t i = 0; i < cameras; ++i) {
+    std::shared_ptr<TrackerManager> tracker;
+    if (work_us >= 0) {
+      tracker = std::make_shared<TrackerManager>();
+      tracker->initialize(std::unique_ptr<FrameTracker>(new StubGazeTracker(tracker_options)));
+    }
+    std::unique_ptr<FrameSource> source(new SyntheticFrameSource(cv::Size(640, 480), fps));
+    manager.add(std::move(source), std::move(tracker), cv::Size(640, 480));
+  }
+  if (!manager.start()) {
+    std::printf("cameras=%zu failed to start\n", cameras);
+    return;
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(seconds));
+  const auto stats = manager.stats();
+  manager.stop();
+
+  double min_fps = stats.cameras.empty() ? 0.0 : stats.cameras.front().fps;
+  int pinned = 0;
+  for (const auto& camera : stats.cameras) {
+    min_fps = std::min(min_fps, camera.fps);
+    pinned += camera.core >= 0 ? 1 : 0;
+  }
+  std::printf("cameras=%zu total_fps=%.1f min_camera_fps=%.1f submit_fps=%.1f missed=%llu pinned=%d\n",
+              cameras, stats.fps, min_fps, stats.submit_fps,
+              static_cast<unsigned long long>(stats.missed), pinned);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto max_cameras = static_cast<std::size_t>(bench::arg(argc, argv, 1, hardware_cores()));
+  const auto fps = static_cast<double>(bench::arg(argc, argv, 2, 30));
+  const auto work_us = bench::arg(argc, argv, 3, 3000);
+  const auto seconds = bench::arg(argc, argv, 4, 3);
+  const bool pin = bench::arg(argc, argv, 5, 0) != 0;
+
+  std::printf("cores=%d fps=%.0f work_us=%ld seconds=%ld pin=%d\n", hardware_cores(), fps, work_us, seconds, pin ? 1 : 0);
+  for (std::size_t cameras = 1; cameras <= max_cameras; ++cameras)
+    run(cameras, fps, work_us, seconds, pin);
+  return 0;
+}
@@ -0,0 +1,93 @@
+/**
+ * SessionHost 처리량: 코어당 몇 개의 세션이 목표 fps를 유지하는지 측정
+ * - 라이선스와 SDK 추적기 없이 StubGazeTracker(프레임당 work_us만큼 CPU 사용)와 SyntheticFrameSource로 세션을 만듦
+ *   (eyedid_frame_tracker.cc를 빌드에 넣지 않으므로 GazeTracker를 만들지 않음)
+ * - 세션 수를 작업 스레드 수의 1, 2, 3, ...배로 늘리며, 가장 느린 세션이 목표 fps의 95% 아래로 떨어지면 멈춤
+ *
+ * 사용법: bench_sessions [workers=코어 수] [work_us=3000] [fps=30] [seconds=3]
+ * 빌드: session_host.cc tracker_manager.cc frame_tracker.cc frame_source.cc color_resize.cc
+ *       thread_affinity.cc latency_trace.cc telemetry.cc executor.cc aoi_registry.cc window_geometry.cc
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_util.h"
+#include "frame_source.h"
+#include "frame_tracker.h"
+#include "session_host.h"
+#include "thread_affinity.h"
+#include "tracker_manager.h"
+
+using namespace sample;
+
+namespace {
+
+struct Result {
+  double total_fps = 0.0;
+  double min_fps = 0.0;
+  std::uint64_t steals = 0;
+  std::uint64_t migrations = 0;
+};
+
+Result run(std::size_t workers, std::size_t sessions, long work_us, double fps, long seconds) {
+  SessionHost::Options host_options;
+  host_options.workers = workers;
+  SessionHost host(host_options);
+
+  StubGazeTracker::Options tracker_options;
+  tracker_options.work = std::chrono::microseconds(work_us);
+  SessionHost::SessionOptions session_options;
+  session_options.fps = fps;
+
+  std::vector<SessionHost::SessionId> ids;
+  for (std::size_t i = 0; i < sessions; ++i) {
+    auto tracker = std::make_shared<TrackerManager>();
+    tracker->initialize(std::unique_ptr<FrameTracker>(new StubGazeTracker(tracker_options)));
+    std::unique_ptr<FrameSource> source(new SyntheticFrameSource(cv::Size(640, 480), 0.0)); // 속도는 session_options.fps로 제한
+    ids.push_back(host.create_session(std::move(tracker), std::move(source), session_options));
+  }
+  for (const auto id : ids)
+    host.start_session(id);
+
+  std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+  Result result;
+  result.min_fps = fps;
+  for (const auto id : ids) {
+    SessionHost::SessionStats stats;
+    host.session_stats(id, &stats);
+    result.total_fps += stats.fps;
+    result.min_fps = std::min(result.min_fps, stats.fps);
+    result.migrations += stats.migrations;
+  }
+  result.steals = host.stats().steals;
+  host.join();
+  return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto workers = static_cast<std::size_t>(bench::arg(argc, argv, 1, hardware_cores()));
+  const auto work_us = bench::arg(argc, argv, 2, 3000);
+  const auto fps = static_cast<double>(bench::arg(argc, argv, 3, 30));
+  const auto seconds = bench::arg(argc, argv, 4, 3);
+
+  std::printf("workers=%zu work_us=%ld fps=%.0f seconds=%ld\n", workers, work_us, fps, seconds);
+  std::size_t kept_up = 0;
+  for (std::size_t sessions = workers; sessions <= workers * 64; sessions += workers) {
+    const auto result = run(workers, sessions, work_us, fps, seconds);
+    std::printf("sessions=%zu total_fps=%.1f min_session_fps=%.1f steals=%llu migrations=%llu\n",
+                sessions, result.total_fps, result.min_fps,
+                static_cast<unsigned long long>(result.steals), static_cast<unsigned long long>(result.migrations));
+    if (result.min_fps < fps * 0.95)
+      break;
+    kept_up = sessions;
+  }
+  std::printf("sessions_per_core=%.2f\n", static_cast<double>(kept_up) / static_cast<double>(workers));
+  return 0;
+}
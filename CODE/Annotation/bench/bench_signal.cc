@@ -0,0 +1,121 @@
+/**
+ * signal 발행 처리량: 초당 발행 횟수 (슬롯 수 × 발행 스레드 수)
+ * - signal: 현재 구현 (copy-on-write 슬롯 배열, 잠금 없이 발행)
+ * - locked: 이전 구현과 같은 방식 (std::list의 std::function 슬롯, 슬롯마다 mutex를 풀고 호출한 뒤 다시 잠금)
+ * - churn: 발행하는 동안 다른 스레드가 1ms마다 connect/disconnect (배열 교체와 해제 비용 포함)
+ *
+ * 사용법: bench_signal [emissions_per_thread=1000000]
+ * 빌드: executor.cc (OpenCV와 SDK는 필요 없음)
+ *   g++ -std=c++14 -O2 -pthread -I.. bench_signal.cc ../executor.cc -o bench_signal
+ *
+ * 결과 (Xeon 1코어 VM, g++ 12.2 -O2, 발행/s): locked가 변경 전, signal이 변경 후
+ *   slots=1  threads=1  signal=52.2M  locked=23.4M  signal_churn=50.0M
+ *   slots=1  threads=4  signal=41.1M  locked=24.6M  signal_churn=38.1M
+ *   slots=4  threads=1  signal=32.9M  locked=8.6M   signal_churn=38.3M
+ *   slots=4  threads=4  signal=43.3M  locked=9.0M   signal_churn=32.1M
+ *   slots=16 threads=1  signal=20.4M  locked=2.6M   signal_churn=17.3M
+ *   slots=16 threads=4  signal=20.3M  locked=2.7M   signal_churn=18.1M
+ *   (코어가 하나뿐이라 발행 스레드끼리의 경합은 드러나지 않음, 여러 코어에서는 locked의 차이가 더 커질 것으로 예상)
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench_util.h"
+#include "simple_signal.h"
+
+using namespace sample;
+
+namespace {
+
+thread_local std::uint64_t sink = 0; // 슬롯이 쓰는 스레드별 값 (공유 변수 경합을 측정에서 제외)
+
+// 이전 구현: 호출할 때 슬롯마다 mutex를 풀고 다시 잠금
+class LockedSignal {
+ public:
+  void connect(std::function<void(int)> func) {
+    std::lock_guard<std::mutex> lck(mutex_);
+    slots_.push_back(std::make_shared<std::function<void(int)>>(std::move(func)));
+  }
+
+  void operator()(int value) {
+    std::unique_lock<std::mutex> lck(mutex_);
+    for (auto it = slots_.begin(); it != slots_.end(); ++it) {
+      lck.unlock();
+      (**it)(value);
+      lck.lock();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::list<std::shared_ptr<std::function<void(int)>>> slots_;
+};
+
+// threads개 스레드가 각각 emissions번 발행하는 데 걸린 시간으로 초당 발행 횟수 계산
+template<typename Emit>
+double emissions_per_s(int threads, long emissions, Emit emit) {
+  std::atomic_bool go{false};
+  std::vector<std::thread> emitters;
+  for (int t = 0; t < threads; ++t) {
+    emitters.emplace_back([&]() {
+      while (!go.load()) {}
+      for (long i = 0; i < emissions; ++i)
+        emit(static_cast<int>(i));
+      bench::keep(sink);
+    });
+  }
+  const auto start = bench::clock::now();
+  go.store(true);
+  for (auto& emitter : emitters)
+    emitter.join();
+  return static_cast<double>(threads) * static_cast<double>(emissions) * 1e9 /
+         static_cast<double>(bench::elapsed_ns(start));
+}
+
+void run(int slots, int threads, long emissions) {
+  signal<void(int)> sig;
+  LockedSignal locked;
+  for (int i = 0; i < slots; ++i) {
+    sig.connect([](int value) { sink += static_cast<std::uint64_t>(value); });
+    locked.connect([](int value) { sink += static_cast<std::uint64_t>(value); });
+  }
+
+  const auto signal_rate = emissions_per_s(threads, emissions, [&](int value) { sig(value); });
+  const auto locked_rate = emissions_per_s(threads, emissions, [&](int value) { locked(value); });
+
+  // 발행 중에 연결이 계속 바뀌는 경우
+  std::atomic_bool stop{false};
+  std::thread churn([&]() {
+    while (!stop.load()) {
+      auto conn = sig.connect([](int value) { sink += static_cast<std::uint64_t>(value); });
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      conn.disconnect();
+    }
+  });
+  const auto churn_rate = emissions_per_s(threads, emissions, [&](int value) { sig(value); });
+  stop.store(true);
+  churn.join();
+
+  std::printf("slots=%d threads=%d signal=%.2fM/s locked=%.2fM/s signal_churn=%.2fM/s\n",
+              slots, threads, signal_rate / 1e6, locked_rate / 1e6, churn_rate / 1e6);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto emissions = bench::arg(argc, argv, 1, 1000000);
+
+  for (const int slots : {1, 4, 16}) {
+    for (const int threads : {1, 2, 4})
+      run(slots, threads, emissions);
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * drawables::Text 글자 마스크 캐시: 캐시를 쓸 때와 쓰지 않을 때(use_cache = false)의 그리기 시간
+ * - HeadlessViewBackend(NullRenderSink)로 창 없이 그리며, 시간은 View::RenderStats의 total_render_us
+ * - 부분 갱신을 끄고 매 프레임 화면 전체를 다시 그림 (글자를 매번 그리는 경우)
+ * - static: 글자가 바뀌지 않음, changing: 한 줄이 매 프레임 바뀜 (캐시를 다시 만드는 경우)
+ *
+ * 사용법: bench_text_cache [frames=300] [lines=8]
+ * 빌드: view.cc view_backend.cc window_geometry.cc latency_trace.cc priority_mutex.cc
+ *   g++ -std=c++14 -O2 -pthread -I.. -I<eyedid SDK>/include bench_text_cache.cc ../view.cc ../view_backend.cc
+ *       ../window_geometry.cc ../latency_trace.cc ../priority_mutex.cc
+ *       $(pkg-config --cflags --libs opencv4) -L<eyedid SDK>/lib -leyedid
+ *
+ * 결과: 아직 없음 (실제 OpenCV가 있는 환경에서 측정하여 기록해야 함)
+ *   한 줄에 변경 전(no_cache=, 글자를 매번 그림)과 변경 후(cache=) 시간이 함께 나옴
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "bench_util.h"
+#include "view.h"
+#include "view_backend.h"
+
+using namespace sample;
+
+namespace {
+
+double render_us_per_frame(bool use_cache, bool changing, long frames, long lines) {
+  View view(1280, 720, "bench_text_cache", std::unique_ptr<ViewBackend>(new HeadlessViewBackend()));
+  view.setDamageTracking(false);
+  view.update([&](ViewState& state) {
+    auto& desc = state.desc.write();
+    desc.resize(static_cast<std::size_t>(lines));
+    for (long i = 0; i < lines; ++i) {
+      auto& text = desc[static_cast<std::size_t>(i)];
+      text.text = "Line " + std::to_string(i) + ": gaze tracking status text";
+      text.org = cv::Point(20, 40 + 40 * static_cast<int>(i));
+      text.use_cache = use_cache;
+    }
+  });
+
+  for (long frame = 0; frame < frames; ++frame) {
+    if (changing) {
+      view.update([frame](ViewState& state) {
+        state.desc.write()[0].text = "Frame " + std::to_string(frame);
+      });
+    }
+    view.draw(0);
+  }
+
+  const auto stats = view.renderStats();
+  return stats.frames != 0 ? static_cast<double>(stats.total_render_us) / static_cast<double>(stats.frames) : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto frames = bench::arg(argc, argv, 1, 300);
+  const auto lines = bench::arg(argc, argv, 2, 8);
+
+  std::printf("frames=%ld lines=%ld\n", frames, lines);
+  for (const bool changing : {false, true}) {
+    const auto cached = render_us_per_frame(true, changing, frames, lines);
+    const auto uncached = render_us_per_frame(false, changing, frames, lines);
+    std::printf("%s cache=%.1fus/frame no_cache=%.1fus/frame speedup=%.2fx\n", changing ? "changing" : "static",
+                cached, uncached, cached > 0.0 ? uncached / cached : 0.0);
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * 추적 객체가 있는 슬롯(tracked slot)의 호출 비용: 슬롯 하나를 호출하는 데 걸리는 시간 (ns)
+ * - plain:   추적 객체가 없는 슬롯
+ * - tracked: connect(func, track), track이 trackable (생존 표시를 읽기만 함)
+ * - weak:    connect(func, track), track이 trackable이 아님 (호출마다 weak_ptr::lock)
+ * - before:  이전 구현과 같은 방식 (std::function으로 감싼 함수를 weak_ptr::lock 하는 람다로 한 번 더 감쌈)
+ * - large:   delegate 내부 버퍼보다 큰 캡처 (힙에 보관, 호출 경로는 같음)
+ *
+ * 사용법: bench_tracked_slot [emissions=5000000]
+ * 빌드: executor.cc (OpenCV와 SDK는 필요 없음)
+ *   g++ -std=c++14 -O2 -pthread -I.. bench_tracked_slot.cc ../executor.cc -o bench_tracked_slot
+ *
+ * 결과 (Xeon 1코어 VM, g++ 12.2 -O2, slots=4, 호출 1회당): before가 변경 전, tracked가 변경 후
+ *   plain=6.7ns  tracked=6.8ns  weak=21.4ns  before=24.1ns  large=6.6ns
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+
+#include "bench_util.h"
+#include "simple_signal.h"
+
+using namespace sample;
+
+namespace {
+
+struct Target {
+  std::uint64_t total = 0;
+  void on_value(int value) { total += static_cast<std::uint64_t>(value); }
+};
+
+struct TrackableTarget : Target, trackable {
+  ~TrackableTarget() { expire_connections(); }
+};
+
+// emissions번 발행하는 데 걸린 시간을 슬롯 하나당 시간으로 환산
+double ns_per_call(signal<void(int)>& sig, std::size_t slots, long emissions) {
+  const auto start = bench::clock::now();
+  for (long i = 0; i < emissions; ++i)
+    sig(static_cast<int>(i));
+  return static_cast<double>(bench::elapsed_ns(start)) / static_cast<double>(emissions) / static_cast<double>(slots);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const auto emissions = bench::arg(argc, argv, 1, 5000000);
+  constexpr std::size_t kSlots = 4;
+
+  auto target = std::make_shared<TrackableTarget>();
+  auto* raw = target.get();
+  std::shared_ptr<Target> weak_target(target, raw); // 같은 객체를 trackable이 아닌 타입으로 추적
+
+  signal<void(int)> plain;
+  signal<void(int)> tracked;
+  signal<void(int)> weak;
+  signal<void(int)> before;
+  signal<void(int)> large;
+  std::array<std::uint64_t, 8> padding{}; // delegate 내부 버퍼(포인터 4개)보다 큰 캡처를 만들기 위한 값
+  for (std::size_t i = 0; i < kSlots; ++i) {
+    plain.connect([raw](int value) { raw->on_value(value); });
+    tracked.connect([raw](int value) { raw->on_value(value); }, target);
+    weak.connect([raw](int value) { raw->on_value(value); }, weak_target);
+
+    std::function<void(int)> func = [raw](int value) { raw->on_value(value); };
+    std::weak_ptr<Target> observer = weak_target;
+    before.connect([func, observer](int value) {
+      if (auto locked = observer.lock())
+        func(value);
+    });
+
+    large.connect([raw, padding](int value) { raw->on_value(value + static_cast<int>(padding[0])); }, target);
+  }
+
+  std::printf("emissions=%ld slots=%zu\n", emissions, kSlots);
+  std::printf("plain=%.2fns/call\n", ns_per_call(plain, kSlots, emissions));
+  std::printf("tracked=%.2fns/call\n", ns_per_call(tracked, kSlots, emissions));
+  std::printf("weak=%.2fns/call\n", ns_per_call(weak, kSlots, emissions));
+  std::printf("before=%.2fns/call\n", ns_per_call(before, kSlots, emissions));
+  std::printf("large=%.2fns/call\n", ns_per_call(large, kSlots, emissions));
+  bench::keep(target->total);
+  return 0;
+}
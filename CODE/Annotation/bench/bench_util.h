@@ -0,0 +1,40 @@
+#ifndef EYEDID_CPP_SAMPLE_BENCH_UTIL_H_
+#define EYEDID_CPP_SAMPLE_BENCH_UTIL_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * 벤치마크 공용 도구
+ * - 각 bench_*.cc는 main()이 있는 독립 프로그램 (상위 디렉터리를 include 경로에 추가하고 필요한 .cc와 함께 빌드)
+ * - 결과는 한 줄에 한 측정값으로 표준 출력에 씀
+ */
+
+namespace sample {
+namespace bench {
+
+using clock = std::chrono::steady_clock;
+
+// start 이후 경과 시간 (ns)
+inline std::int64_t elapsed_ns(clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+}
+
+// 명령행 인수 argv[index] (없으면 fallback)
+inline long arg(int argc, char** argv, int index, long fallback) {
+  return index < argc ? std::strtol(argv[index], nullptr, 10) : fallback;
+}
+
+// 컴파일러가 계산을 없애지 않도록 값을 남김 (산술 값, 스레드마다 따로 보관)
+template<typename T>
+inline void keep(T value) {
+  static thread_local volatile T sink;
+  sink = value;
+  (void)sink;
+}
+
+} // namespace bench
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_BENCH_UTIL_H_
@@ -1,14 +1,25 @@
 #include "camera_thread.h"
 
+#include <chrono>
 #include <iostream>
 #include <thread>
 #include <utility>
 
+#include "thread_affinity.h"
+
 namespace sample {
 
+namespace {
+
+// бⰡ   ٽ õϱ  ð (а ̾  CPU   ʵ)
+constexpr auto kReadRetryDelay = std::chrono::milliseconds(10);
+
+} // namespace
+
 // CameraThread 
 // - ü   ο 带 ϰ run_impl() ޼带 
-CameraThread::CameraThread() {
+CameraThread::CameraThread(std::uint32_t source_id)
+: source_id_(source_id) {
   thread_ = std::thread([this](){
     run_impl();
   });
@@ -22,15 +33,18 @@ CameraThread::~CameraThread() {
 
 // ī޶  ޼
 // - ־ ī޶ ε Ͽ ī޶ 
-// - ī޶ ¸ Ȯϰ pause Ͽ  
 bool CameraThread::run(int camera_index) {
-  if (camera_index == camera_index_) { // ̹  ī޶   
-    resume(); //  · ȯ
-  }
+  return run(std::unique_ptr<FrameSource>(new CameraFrameSource(camera_index)));
+}
 
+//  ҽ  ޼
+// -  ҽ ݰ  ҽ ¸ Ȯ  pause Ͽ  
+bool CameraThread::run(std::unique_ptr<FrameSource> source) {
   auto lck = pause_wait(); // pause ·   
-  camera_index_ = camera_index; // ο ī޶ ε 
-  if (!check_status()) // ī޶  Ȯ
+  if (source_)
+    source_->close(); //  ҽ ݱ
+  source_ = std::move(source); // ο  ҽ 
+  if (!source_ || !check_status()) // ī޶  Ȯ
     return false; // ī޶ ⿡ ϸ false ȯ
   lck.unlock(); //  
 
@@ -40,6 +54,15 @@ bool CameraThread::run(int camera_index) {
   return true;
 }
 
+//  ҽ ȯ ޼
+// - run()  ҽ ٽ õϰų ٸ ī޶ ű  
+std::unique_ptr<FrameSource> CameraThread::release_source() {
+  auto lck = pause_wait(); // ĸó  ҽ  ʵ pause ·   
+  if (source_)
+    source_->close();
+  return std::move(source_);
+}
+
 // ī޶ Ͻ ޼
 // - pause · ȯϰ   忡 ˸
 void CameraThread::pause() {
@@ -58,52 +81,128 @@ std::unique_lock<std::mutex> CameraThread::pause_wait() {
 
 // ī޶ 簳 ޼
 // - pause ¸ ϰ    
-void CameraThread::resume() {
-  pause_ = false; // pause  
+// - Ͻ ߿ ĸó    ϹǷ ҽ Ȯ  ᰡ  ٸ 
+bool CameraThread::resume() {
+  if (!pause_)
+    return true; // ̹  
+
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    if (!source_)
+      return false; // release_source() ҽ  ڿ run()θ ٽ 
+    pause_ = false; // pause  
+  }
   cv_.notify_all(); //    
+  return true;
 }
 
 //   ޼ ( ۾ )
-// - pause ¿ ϰ, ī޶  о ̺Ʈ(on_frame_) 
+// - pause ¿ ϰ,  ҽ  о ̺Ʈ(on_frame_) 
 void CameraThread::run_impl() {
+  LatencyTracer::set_thread_name("camera");
   std::unique_lock<std::mutex> lck(mutex_); // mutex 
 
   while (true) {
-    // pause ° ǰų stop °   
+    // pause ° ǰų stop °    ( ҽ   )
     cv_.wait(lck, [this]() -> bool {
-      return !pause_ || stop_;
+      return (!pause_ && source_) || stop_;
     });
 
     if (stop_) // stop ¸  
       break;
 
-    video_ >> frame_; // ī޶󿡼  б
-    on_frame_(std::move(frame_)); //  ̺Ʈ 
+    cv::Mat* frame = frame_pool_.acquire(); //   
+    if (frame == nullptr) { //  ۰  ̸
+      if (source_->skip()) // ϸ ڵ   
+        ++sequence_; //  ӵ ȣ Ͽ ޴     
+      else
+        read_failed(lck);
+      continue;
+    }
+
+    TraceSpan span(TraceStage::kCapture);
+    if (!source_->read(*frame)) { //  б (ũⰡ  Ҵ )
+      span.cancel();
+      read_failed(lck); // б  Ǵ ð ʰ  ٽ õ
+      continue;
+    }
+    const auto read_ns = LatencyTracer::now_ns();
+    frame_pool_.commit(frame);
+
+    envelope_.frame = *frame;
+    envelope_.sequence = ++sequence_;
+    envelope_.source_id = source_id_;
+    envelope_.hardware_timestamp = source_->capture_timestamp(&envelope_.capture_ns); // ġ Ÿӽ  
+    if (!envelope_.hardware_timestamp)
+      envelope_.capture_ns = read_ns;
+
+    span.set_frame(envelope_.trace_id());
+    span.end();
+    LatencyTracer::instance().note_capture(envelope_.trace_id(), envelope_.capture_ns); // ĸó   
+
+    on_frame_(envelope_); //  ̺Ʈ 
+    envelope_.frame.release(); //  ӱ ۸  ʵ  
+    frame_ring_.publish(*frame); // Һ 忡  
   }
 }
 
+// б  ó ޼
+// - ݺ ʴ    Ͻ (run()̳ resume() ٽ )
+// -   д  ٸ  ٽ õ ( ߿ pause/join ٷ )
+void CameraThread::read_failed(std::unique_lock<std::mutex>& lck) {
+  if (source_->end_of_stream()) {
+    std::cerr << source_->name() << " reached the end of the stream\n";
+    pause_ = true;
+    return;
+  }
+
+  cv_.wait_for(lck, kReadRetryDelay, [this]() -> bool {
+    return pause_ || stop_;
+  });
+}
+
+//  Ǯ ũ  ޼
+// - ĸó  ۸  ʵ pause ¿    · 
+void CameraThread::set_frame_pool_depth(std::size_t depth) {
+  const bool was_running = !pause_;
+
+  auto lck = pause_wait(); // pause ·   
+  frame_pool_.resize(depth);
+  lck.unlock();
+
+  if (was_running)
+    resume();
+}
+
+//   ޼
+// - ī޶     ĸó 峢  ھ   ʵ 
+bool CameraThread::set_affinity(int core) {
+  return pin_thread(thread_, core);
+}
+
 //    ޼
 // - stop · ϰ 尡   
 void CameraThread::join() {
   stop_.store(true, std::memory_order_release); // stop  
   cv_.notify_all(); //    
+  frame_ring_.close(); //  ٸ Һ 
 
   if (thread_.joinable()) // 尡  ̸
     thread_.join(); //   
 }
 
 // ī޶  Ȯ ޼
-// - ī޶      ִ Ȯ
+// -  ҽ      ִ Ȯ
 bool CameraThread::check_status() {
-  video_.open(camera_index_); // ־ ε ī޶ 
-  if (!video_.isOpened()) { // ī޶ ⿡  
-    std::cerr << "Failed to open camera\n";
+  if (!source_->open()) { // ҽ ⿡  
+    std::cerr << "Failed to open " << source_->name() << '\n';
     return false;
-  } else if ((video_ >> frame_, frame_.empty())) { //    
-    std::cerr << "Camera is opened, but failed to get a frame. Try changing the camera_index\n";
+  } else if (!source_->read(frame_)) { //    
+    std::cerr << source_->name() << " is opened, but failed to get a frame. Try changing the camera_index\n";
     return false;
   }
 
+  frame_.release(); // Ȯο  ҽ ޸( ޸  )  ʵ 
   return true; //  
 }
 
@@ -2,10 +2,18 @@
 #define EYEDID_CPP_SAMPLE_CAMERA_THREAD_H_
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include "opencv2/opencv.hpp"
+#include "frame_envelope.h"
+#include "frame_pool.h"
+#include "frame_ring.h"
+#include "frame_source.h"
+#include "latency_trace.h"
 #include "simple_signal.h"
 
 namespace sample {
@@ -14,31 +22,63 @@ namespace sample {
 * CameraThread Ŭ:
 * ī޶  忡 ϱ  Ŭ 
 * on_frame_   ʸ ߰ϰų  
+*  FrameSource Ƿ ī޶   , ռ ,  ޸𸮵  
 */
 class CameraThread {
  public:
-  CameraThread(); // ⺻ 
+  explicit CameraThread(std::uint32_t source_id = 0); // source_id: ӿ  ҽ ȣ
   ~CameraThread(); // Ҹ
 
-  //ī޶  ޼
+  //ī޶  ޼ (CameraFrameSource )
   bool run(int camera_index = 0);
 
-  void resume(); // Ͻ ī޶ ٽ 
+  //   ҽ  ( ҽ ݰ ü)
+  // - ص ҽ ī޶ 尡  Ƿ release_source()   
+  bool run(std::unique_ptr<FrameSource> source);
+
+  // ī޶ Ͻϰ  ҽ ݾ  ( nullptr)
+  std::unique_ptr<FrameSource> release_source();
+
+  // Ͻ ī޶ ٽ  ( ҽ (release_source() )  ʰ false ȯ)
+  bool resume();
   void pause(); // ī޶ Ͻ
 
   void join(); //   
 
-  // ο  ϸ Ǵ ñ׳
-  signal<void(cv::Mat frame)> on_frame_;
+  //  Ǯ    (ī޶    )
+  void set_frame_pool_depth(std::size_t depth);
+
+  std::uint32_t source_id() const { return source_id_; }
+
+  // ī޶ 带 CPU ھ ϳ  (  false)
+  bool set_affinity(int core);
+
+  //  Ǯ   (hit/miss/drop)
+  FramePool::Stats frame_pool_stats() const { return frame_pool_.stats(); }
+
+  // ĸó  ϴ  
+  // -  Һڴ FrameConsumerThread Ͽ ī޶  и
+  FrameRing& frame_ring() { return frame_ring_; }
+
+  // ο  ϸ Ǵ ñ׳ (ī޶ 忡  )
+  // - Ӱ ĸó ð,  ȣ, ҽ ȣ Բ 
+  // -  ۴ Ǯ ǹǷ  ȯǸ  ӿ   
+  // -  Ϸ FrameEnvelope(Ǵ cv::Mat) ( )ϸ ǰ, ׵ ش ۴  
+  signal<void(const FrameEnvelope& envelope)> on_frame_;
 
  private:
   void run_impl(); //    
+  void read_failed(std::unique_lock<std::mutex>& lck); // б  ó (Ʈ ̸ Ͻ, ƴϸ  )
   bool check_status(); //  Ȯ
   std::unique_lock<std::mutex> pause_wait(); // Ͻ  
 
-  int camera_index_ = 0; //  ī޶ ε
-  cv::VideoCapture video_; // OpenCV  ĸó ü
-  cv::Mat frame_; //   
+  std::unique_ptr<FrameSource> source_; //   Է ġ
+  cv::Mat frame_; // ī޶  Ȯο 
+  FramePool frame_pool_; // ĸó    
+  FrameRing frame_ring_; // Һ   ϴ  
+  const std::uint32_t source_id_; //  ҽ ȣ
+  std::uint64_t sequence_ = 0; //  аų ǳʶ  ȣ (ī޶  , 1)
+  FrameEnvelope envelope_; // on_frame_    (ī޶  )
 
   std::thread thread_; // ī޶   
   std::atomic_bool pause_{ true }; // Ͻ ¸ Ÿ 
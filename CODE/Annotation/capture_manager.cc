@@ -0,0 +1,161 @@
+#include "capture_manager.h"
+
+#include <iostream>
+#include <utility>
+
+#include "latency_trace.h"
+#include "thread_affinity.h"
+
+namespace sample {
+
+CaptureManager::CaptureManager()
+: CaptureManager(Options()) {}
+
+CaptureManager::CaptureManager(const Options& options)
+: options_(options) {}
+
+// 카메라 스레드를 모두 종료한 뒤(on_frame()이 더 이상 실행되지 않음) 전달 스레드를 종료
+CaptureManager::~CaptureManager() {
+  for (auto& pipeline : pipelines_)
+    pipeline->camera->join();
+  pipelines_.clear();
+}
+
+std::size_t CaptureManager::add(std::unique_ptr<FrameSource> source,
+                                std::shared_ptr<TrackerManager> tracker,
+                                cv::Size target_size) {
+  const auto index = pipelines_.size();
+  std::unique_ptr<Pipeline> pipeline(new Pipeline());
+  pipeline->source_id = static_cast<std::uint32_t>(index);
+  pipeline->source = std::move(source);
+  pipeline->tracker = std::move(tracker);
+  pipeline->camera.reset(new CameraThread(pipeline->source_id));
+  if (pipeline->tracker)
+    pipeline->feed.reset(new LatestFrameFeed(*pipeline->tracker, target_size));
+
+  if (options_.pin_threads) {
+    // 허용된 코어 목록에서 파이프라인마다 두 개씩 차례로 배정 (모자라면 돌려 쓰지 않고 고정을 건너뜀)
+    const auto cores = allowed_cores();
+    const auto slot = static_cast<std::size_t>(options_.first_core) + index * 2;
+    const auto needed = pipeline->feed ? slot + 2 : slot + 1;
+    if (options_.first_core < 0 || needed > cores.size()) {
+      std::cerr << "Not enough cores to pin camera " << pipeline->source_id
+                << " (" << cores.size() << " allowed, " << needed << " needed); running unpinned\n";
+    } else {
+      if (pipeline->camera->set_affinity(cores[slot]))
+        pipeline->core = cores[slot];
+      else
+        std::cerr << "Failed to pin camera " << pipeline->source_id << " to core " << cores[slot] << '\n';
+      if (pipeline->feed && !pipeline->feed->set_affinity(cores[slot + 1]))
+        std::cerr << "Failed to pin the feed of camera " << pipeline->source_id << " to core " << cores[slot + 1] << '\n';
+    }
+  }
+
+  // 정렬 대기 중인 프레임도 풀 버퍼를 참조하므로 그만큼 버퍼를 늘림
+  if (options_.align)
+    pipeline->camera->set_frame_pool_depth(FramePool::kDefaultDepth + options_.align_depth);
+
+  auto* p = pipeline.get();
+  p->camera->on_frame_.connect([this, p](const FrameEnvelope& envelope) {
+    on_frame(p, envelope);
+  });
+
+  pipelines_.push_back(std::move(pipeline));
+  return index;
+}
+
+std::size_t CaptureManager::add_camera(int camera_index,
+                                       std::shared_ptr<TrackerManager> tracker,
+                                       cv::Size target_size) {
+  return add(std::unique_ptr<FrameSource>(new CameraFrameSource(camera_index)), std::move(tracker), target_size);
+}
+
+// 처음에는 소스를 열어 실행하고, stop() 뒤에는 재개만 함
+bool CaptureManager::start() {
+  if (options_.align && !aligner_ && !pipelines_.empty()) {
+    aligner_.reset(new FrameAligner(pipelines_.size(), options_.align_tolerance_us * 1000, options_.align_depth));
+  }
+  if (aligner_)
+    aligner_->clear(); // 일시정지 전의 프레임과 묶이지 않도록 함
+
+  std::int64_t expected = 0;
+  start_ns_.compare_exchange_strong(expected, LatencyTracer::now_ns());
+
+  for (auto& pipeline : pipelines_) {
+    if (pipeline->started && pipeline->camera->resume())
+      continue;
+    pipeline->started = false; // 소스가 없어 재개하지 못하면 처음처럼 다시 실행
+
+    if (pipeline->source && pipeline->camera->run(std::move(pipeline->source))) {
+      pipeline->started = true;
+    } else {
+      if (!pipeline->source)
+        pipeline->source = pipeline->camera->release_source(); // 다음 start()에서 다시 시도
+      stop();
+      return false;
+    }
+  }
+  return true;
+}
+
+void CaptureManager::stop() {
+  for (auto& pipeline : pipelines_)
+    pipeline->camera->pause();
+}
+
+CaptureManager::Stats CaptureManager::stats() const {
+  Stats stats;
+  const auto start_ns = start_ns_.load(std::memory_order_relaxed);
+  if (start_ns != 0)
+    stats.elapsed_s = static_cast<double>(LatencyTracer::now_ns() - start_ns) * 1e-9;
+
+  stats.cameras.reserve(pipelines_.size());
+  for (const auto& pipeline : pipelines_) {
+    CameraStats camera;
+    camera.source_id = pipeline->source_id;
+    camera.core = pipeline->core;
+    camera.frames = pipeline->frames.load(std::memory_order_relaxed);
+    camera.missed = pipeline->missed.load(std::memory_order_relaxed);
+    camera.pool = pipeline->camera->frame_pool_stats();
+    if (pipeline->feed) {
+      camera.has_feed = true;
+      camera.feed = pipeline->feed->stats();
+    }
+    if (stats.elapsed_s > 0.0)
+      camera.fps = static_cast<double>(camera.frames) / stats.elapsed_s;
+
+    stats.frames += camera.frames;
+    stats.missed += camera.missed;
+    stats.submitted += camera.feed.submitted;
+    stats.fps += camera.fps;
+    stats.cameras.push_back(camera);
+  }
+  if (stats.elapsed_s > 0.0)
+    stats.submit_fps = static_cast<double>(stats.submitted) / stats.elapsed_s;
+
+  if (aligner_) {
+    const auto aligner = aligner_->stats();
+    stats.aligned = aligner.aligned;
+    stats.unaligned = aligner.unaligned;
+  }
+  return stats;
+}
+
+// 카메라 스레드에서 실행
+// - 다른 파이프라인과 공유하는 것은 정렬(aligner_)뿐
+void CaptureManager::on_frame(Pipeline* pipeline, const FrameEnvelope& envelope) {
+  if (pipeline->last_sequence != 0 && envelope.sequence > pipeline->last_sequence + 1)
+    pipeline->missed.fetch_add(envelope.sequence - pipeline->last_sequence - 1, std::memory_order_relaxed);
+  pipeline->last_sequence = envelope.sequence;
+  pipeline->frames.fetch_add(1, std::memory_order_relaxed);
+
+  if (pipeline->feed)
+    pipeline->feed->push(envelope); // 참조만 넘기므로 카메라 스레드를 막지 않음
+
+  if (aligner_ && aligner_->push(pipeline->source_id, envelope, &pipeline->aligned)) {
+    on_aligned_(pipeline->aligned);
+    pipeline->aligned.clear(); // 묶음의 프레임 버퍼를 바로 놓음
+  }
+}
+
+} // namespace sample
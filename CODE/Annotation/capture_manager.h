@@ -0,0 +1,139 @@
+#ifndef EYEDID_CPP_SAMPLE_CAPTURE_MANAGER_H_
+#define EYEDID_CPP_SAMPLE_CAPTURE_MANAGER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "camera_thread.h"
+#include "frame_aligner.h"
+#include "frame_envelope.h"
+#include "frame_pool.h"
+#include "frame_source.h"
+#include "opencv2/opencv.hpp"
+#include "simple_signal.h"
+#include "tracker_feed.h"
+#include "tracker_manager.h"
+
+namespace sample {
+
+/**
+ * CaptureManager 클래스:
+ * - 카메라(프레임 소스) 여러 대를 각자의 파이프라인으로 동시에 실행
+ *   - 파이프라인: CameraThread → LatestFrameFeed → TrackerManager (카메라마다 따로)
+ *   - 파이프라인끼리는 잠금이나 공유 상태가 없으므로 코어 수만큼 처리량이 늘어남
+ *     (정렬을 켜면 FrameAligner의 잠금 하나를 공유)
+ * - 카메라 스레드와 전달 스레드를 파이프라인마다 다른 코어에 고정 (Options::pin_threads, 기본은 끔)
+ *   - 허용된 코어 목록(allowed_cores())에서 파이프라인 i의 카메라 스레드는 first_core + 2i번째,
+ *     전달 스레드는 first_core + 2i + 1번째 코어
+ *   - 코어가 모자라면 돌려 쓰지 않고 그 파이프라인은 고정하지 않음 (std::cerr에 기록, CameraStats::core == -1)
+ *   - SDK 내부 추적 스레드는 고정할 수 없음
+ * - 정렬을 켜면 캡처 시각이 가까운 프레임을 카메라마다 하나씩 묶어 on_aligned_로 발행
+ * - add()는 start() 전에 GUI(생성) 스레드에서만 호출해야 함, stats()는 어느 스레드에서나 호출 가능
+ */
+class CaptureManager {
+ public:
+  struct Options {
+    bool pin_threads = false;              // 파이프라인 스레드를 코어에 고정
+    int first_core = 0;                    // 첫 파이프라인이 쓸 코어의 allowed_cores() 위치
+    bool align = false;                    // 카메라 간 프레임 정렬 (on_aligned_)
+    std::int64_t align_tolerance_us = 8000; // 한 묶음 안의 캡처 시각 차이 허용 범위 (us)
+    std::size_t align_depth = 3;           // 카메라별 정렬 대기 프레임 수
+  };
+
+  // 카메라별 통계
+  struct CameraStats {
+    std::uint32_t source_id = 0;
+    int core = -1;                  // 카메라 스레드를 고정한 코어 (고정하지 않았으면 -1)
+    std::uint64_t frames = 0;       // 캡처한 프레임 수
+    std::uint64_t missed = 0;       // 카메라 스레드에서 버린 프레임 수 (프레임 번호의 빈 번호)
+    double fps = 0.0;               // start() 이후 평균 캡처 속도
+    FramePool::Stats pool;          // 프레임 풀 사용 통계
+    bool has_feed = false;          // TrackerManager에 연결되어 있는지
+    LatestFrameFeed::Stats feed;    // SDK 전달 통계 (has_feed일 때만)
+  };
+
+  // 전체 통계
+  struct Stats {
+    double elapsed_s = 0.0;         // start() 이후 실행 시간 (초)
+    std::uint64_t frames = 0;       // 모든 카메라의 캡처 프레임 수
+    std::uint64_t missed = 0;
+    std::uint64_t submitted = 0;    // 모든 카메라에서 SDK에 전달한 프레임 수
+    double fps = 0.0;               // 모든 카메라의 캡처 속도 합
+    double submit_fps = 0.0;        // 모든 카메라의 SDK 전달 속도 합
+    std::uint64_t aligned = 0;      // 정렬된 묶음 수
+    std::uint64_t unaligned = 0;    // 정렬하지 못하고 버린 프레임 수
+    std::vector<CameraStats> cameras;
+  };
+
+  CaptureManager();
+  explicit CaptureManager(const Options& options);
+  ~CaptureManager();
+
+  CaptureManager(const CaptureManager&) = delete;
+  CaptureManager& operator=(const CaptureManager&) = delete;
+
+  /**
+   * 프레임 소스 추가
+   * @param source      프레임 소스 (start()에서 실행)
+   * @param tracker     프레임을 전달할 TrackerManager (없으면 캡처만 함, 초기화된 상태여야 함)
+   * @param target_size SDK에 전달할 프레임 크기 (비어 있으면 카메라 해상도 유지)
+   * @return 파이프라인 번호 (프레임의 source_id와 같음)
+   */
+  std::size_t add(std::unique_ptr<FrameSource> source,
+                  std::shared_ptr<TrackerManager> tracker = nullptr,
+                  cv::Size target_size = cv::Size());
+
+  // 카메라를 인덱스로 추가 (CameraFrameSource)
+  std::size_t add_camera(int camera_index,
+                         std::shared_ptr<TrackerManager> tracker = nullptr,
+                         cv::Size target_size = cv::Size());
+
+  /**
+   * 모든 카메라 실행 (stop() 뒤에 다시 호출하면 재개)
+   * @return 하나라도 열지 못하면 이미 실행한 카메라를 멈추고 false (열지 못한 소스는 보관하므로 다시 호출하면 재시도)
+   */
+  bool start();
+  void stop(); // 모든 카메라 일시정지
+
+  std::size_t size() const { return pipelines_.size(); }
+
+  // 파이프라인의 카메라 (프레임 소비자 연결용: frame_ring(), on_frame_)
+  CameraThread& camera(std::size_t index) { return *pipelines_[index]->camera; }
+  TrackerManager* tracker(std::size_t index) { return pipelines_[index]->tracker.get(); }
+
+  Stats stats() const;
+
+  // 정렬된 프레임 묶음 (카메라 번호 순, 마지막 프레임을 넣은 카메라 스레드에서 동기적으로 실행)
+  signal<void(const std::vector<FrameEnvelope>& frames)> on_aligned_;
+
+ private:
+  struct Pipeline {
+    std::uint32_t source_id = 0;
+    int core = -1;
+    std::unique_ptr<FrameSource> source;        // 처음 start()에 성공할 때까지 보관
+    bool started = false;
+    std::shared_ptr<TrackerManager> tracker;
+    std::unique_ptr<LatestFrameFeed> feed;      // camera보다 먼저 선언하여 camera가 먼저 소멸
+    std::unique_ptr<CameraThread> camera;
+    std::uint64_t last_sequence = 0;            // 카메라 스레드 전용
+    std::vector<FrameEnvelope> aligned;         // 정렬 묶음 버퍼 (카메라 스레드 전용)
+
+    // 파이프라인마다 따로 할당하므로 카메라 스레드끼리 같은 카운터를 갱신하지 않음
+    std::atomic<std::uint64_t> frames{0};
+    std::atomic<std::uint64_t> missed{0};
+  };
+
+  void on_frame(Pipeline* pipeline, const FrameEnvelope& envelope); // 카메라 스레드
+
+  const Options options_;
+  std::unique_ptr<FrameAligner> aligner_; // 처음 start()할 때 카메라 수에 맞춰 생성
+  std::vector<std::unique_ptr<Pipeline>> pipelines_;
+  std::atomic<std::int64_t> start_ns_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_CAPTURE_MANAGER_H_
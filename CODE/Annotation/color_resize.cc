@@ -0,0 +1,187 @@
+#include "color_resize.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#  define EYEDID_SAMPLE_SIMD_AVX2 1
+#elif defined(__SSE4_1__)
+#  include <smmintrin.h>
+#  define EYEDID_SAMPLE_SIMD_SSE41 1
+#endif
+
+namespace sample {
+
+namespace {
+
+constexpr int kWeightBits = 8;                 // 보간 가중치 정밀도
+constexpr int kWeightOne = 1 << kWeightBits;   // 가중치 1.0
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2) || defined(EYEDID_SAMPLE_SIMD_SSE41)
+// 5픽셀(15바이트)의 B, R 채널을 교환하는 셔플 마스크 (마지막 바이트는 다음 반복에서 덮어씀)
+inline __m128i swap_mask() {
+  return _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+}
+#endif
+
+// 한 행의 B, R 채널 교환
+void swap_channels_row(const std::uint8_t* src, std::uint8_t* dst, int pixels) {
+  const int bytes = pixels * 3;
+  int i = 0;
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2)
+  // 두 128비트 레인에 연속된 5픽셀씩 올려 한 번에 10픽셀 처리
+  const __m256i mask = _mm256_broadcastsi128_si256(swap_mask());
+  for (; i + 32 <= bytes; i += 30) {
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 15));
+    const __m256i v = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 15), _mm256_extracti128_si256(v, 1));
+  }
+#elif defined(EYEDID_SAMPLE_SIMD_SSE41)
+  const __m128i mask = swap_mask();
+  for (; i + 16 <= bytes; i += 15) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+  }
+#endif
+
+  for (; i < bytes; i += 3) {
+    const std::uint8_t b = src[i];
+    dst[i] = src[i + 2];
+    dst[i + 1] = src[i + 1];
+    dst[i + 2] = b;
+  }
+}
+
+// 두 원본 행을 세로로 보간하여 16비트 행 버퍼에 저장 (값 범위: 0 ~ 255 * 256)
+void blend_rows(const std::uint8_t* s0, const std::uint8_t* s1, std::uint16_t w1,
+                std::uint16_t* row, int n) {
+  const std::uint16_t w0 = static_cast<std::uint16_t>(kWeightOne - w1);
+  int i = 0;
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2)
+  const __m256i vw0 = _mm256_set1_epi16(static_cast<short>(w0));
+  const __m256i vw1 = _mm256_set1_epi16(static_cast<short>(w1));
+  for (; i + 16 <= n; i += 16) {
+    const __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s0 + i)));
+    const __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s1 + i)));
+    const __m256i v = _mm256_add_epi16(_mm256_mullo_epi16(a, vw0), _mm256_mullo_epi16(b, vw1));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + i), v);
+  }
+#elif defined(EYEDID_SAMPLE_SIMD_SSE41)
+  const __m128i vw0 = _mm_set1_epi16(static_cast<short>(w0));
+  const __m128i vw1 = _mm_set1_epi16(static_cast<short>(w1));
+  for (; i + 8 <= n; i += 8) {
+    const __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(s0 + i)));
+    const __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(s1 + i)));
+    const __m128i v = _mm_add_epi16(_mm_mullo_epi16(a, vw0), _mm_mullo_epi16(b, vw1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), v);
+  }
+#endif
+
+  for (; i < n; ++i)
+    row[i] = static_cast<std::uint16_t>(s0[i] * w0 + s1[i] * w1);
+}
+
+// 보간 위치 테이블 계산 (cv::INTER_LINEAR와 같은 픽셀 중심 정렬)
+void make_table(int src_len, int dst_len, std::vector<int>* ofs0, std::vector<int>* ofs1,
+                std::vector<std::uint16_t>* weights) {
+  ofs0->resize(dst_len);
+  ofs1->resize(dst_len);
+  weights->resize(dst_len);
+
+  const double scale = static_cast<double>(src_len) / dst_len;
+  for (int d = 0; d < dst_len; ++d) {
+    double f = (d + 0.5) * scale - 0.5;
+    int s = static_cast<int>(std::floor(f));
+    f -= s;
+    if (s < 0) {
+      s = 0;
+      f = 0;
+    } else if (s >= src_len - 1) {
+      s = src_len - 1;
+      f = 0;
+    }
+    (*ofs0)[d] = s;
+    (*ofs1)[d] = std::min(s + 1, src_len - 1);
+    (*weights)[d] = static_cast<std::uint16_t>(std::lround(f * kWeightOne));
+  }
+}
+
+} // namespace
+
+BgrToRgbResizer::BgrToRgbResizer(cv::Size target_size)
+: target_size_(target_size) {}
+
+const char* BgrToRgbResizer::simd_path() {
+#if defined(EYEDID_SAMPLE_SIMD_AVX2)
+  return "AVX2";
+#elif defined(EYEDID_SAMPLE_SIMD_SSE41)
+  return "SSE4.1";
+#else
+  return "scalar";
+#endif
+}
+
+void BgrToRgbResizer::prepare(cv::Size src_size, cv::Size dst_size) {
+  if (src_size == src_size_ && dst_size == dst_size_)
+    return;
+  src_size_ = src_size;
+  dst_size_ = dst_size;
+
+  make_table(src_size.width, dst_size.width, &x_ofs0_, &x_ofs1_, &x_w_);
+  for (auto& x : x_ofs0_) x *= 3; // 픽셀 인덱스 → 바이트 오프셋
+  for (auto& x : x_ofs1_) x *= 3;
+  make_table(src_size.height, dst_size.height, &y_ofs0_, &y_ofs1_, &y_w_);
+  row_.resize(static_cast<std::size_t>(src_size.width) * 3);
+}
+
+// 변환 수행
+// - 같은 크기: 행 단위 채널 교환
+// - 다른 크기: 출력 행마다 원본 두 행을 세로 보간(SIMD)한 뒤 가로 보간하면서 채널 교환
+void BgrToRgbResizer::convert(const cv::Mat& src, cv::Mat* dst) {
+  if (src.empty())
+    return;
+
+  const cv::Size dst_size = target_size_.empty() ? src.size() : target_size_;
+  if (src.type() != CV_8UC3) { // 지원하지 않는 형식은 OpenCV 경로로 처리
+    cv::Mat converted;
+    cv::cvtColor(src, converted, cv::COLOR_BGR2RGB);
+    cv::resize(converted, *dst, dst_size);
+    return;
+  }
+
+  dst->create(dst_size, CV_8UC3);
+
+  if (dst_size == src.size()) {
+    for (int y = 0; y < src.rows; ++y)
+      swap_channels_row(src.ptr<std::uint8_t>(y), dst->ptr<std::uint8_t>(y), src.cols);
+    return;
+  }
+
+  prepare(src.size(), dst_size);
+  const int src_bytes = src.cols * 3;
+  std::uint16_t* row = row_.data();
+
+  for (int dy = 0; dy < dst_size.height; ++dy) {
+    blend_rows(src.ptr<std::uint8_t>(y_ofs0_[dy]), src.ptr<std::uint8_t>(y_ofs1_[dy]), y_w_[dy], row, src_bytes);
+
+    std::uint8_t* out = dst->ptr<std::uint8_t>(dy);
+    for (int dx = 0; dx < dst_size.width; ++dx) {
+      const std::uint32_t w1 = x_w_[dx];
+      const std::uint32_t w0 = kWeightOne - w1;
+      const std::uint16_t* p0 = row + x_ofs0_[dx];
+      const std::uint16_t* p1 = row + x_ofs1_[dx];
+      constexpr std::uint32_t round = 1u << (2 * kWeightBits - 1);
+      out[0] = static_cast<std::uint8_t>((p0[2] * w0 + p1[2] * w1 + round) >> (2 * kWeightBits)); // R
+      out[1] = static_cast<std::uint8_t>((p0[1] * w0 + p1[1] * w1 + round) >> (2 * kWeightBits)); // G
+      out[2] = static_cast<std::uint8_t>((p0[0] * w0 + p1[0] * w1 + round) >> (2 * kWeightBits)); // B
+      out += 3;
+    }
+  }
+}
+
+} // namespace sample
@@ -0,0 +1,59 @@
+#ifndef EYEDID_CPP_SAMPLE_COLOR_RESIZE_H_
+#define EYEDID_CPP_SAMPLE_COLOR_RESIZE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * BgrToRgbResizer 클래스:
+ * - BGR → RGB 채널 변환과 크기 조정(bilinear)을 한 번의 메모리 읽기로 수행
+ *   (cv::cvtColor + cv::resize 두 번 읽는 것을 대체)
+ * - 목표 크기가 비어 있거나 원본과 같으면 채널 변환만 수행
+ * - SIMD 경로는 컴파일 옵션으로 결정 (AVX2 → SSE4.1 → 스칼라 순)
+ * - 크기별 보간 테이블과 행 버퍼를 보관하므로 같은 크기가 반복되면 메모리 할당이 없음
+ * - 한 스레드에서만 사용해야 함
+ */
+class BgrToRgbResizer {
+ public:
+  /**
+   * @param target_size 출력 크기 (비어 있으면 원본 크기 유지)
+   */
+  explicit BgrToRgbResizer(cv::Size target_size = cv::Size());
+
+  void set_target_size(cv::Size target_size) { target_size_ = target_size; }
+  cv::Size target_size() const { return target_size_; }
+
+  /**
+   * 변환 수행
+   * @param src BGR 프레임 (CV_8UC3)
+   * @param dst 호출자가 제공하는 출력 버퍼 (크기나 타입이 다를 때만 재할당)
+   */
+  void convert(const cv::Mat& src, cv::Mat* dst);
+
+  // 컴파일된 SIMD 경로 이름 ("AVX2", "SSE4.1", "scalar")
+  static const char* simd_path();
+
+ private:
+  // 원본/출력 크기가 바뀌었을 때 보간 테이블 재계산
+  void prepare(cv::Size src_size, cv::Size dst_size);
+
+  cv::Size target_size_;
+  cv::Size src_size_;
+  cv::Size dst_size_;
+
+  std::vector<int> x_ofs0_;           // 출력 x별 왼쪽 원본 픽셀 바이트 오프셋
+  std::vector<int> x_ofs1_;           // 출력 x별 오른쪽 원본 픽셀 바이트 오프셋
+  std::vector<std::uint16_t> x_w_;    // 출력 x별 오른쪽 가중치 (0 ~ 256)
+  std::vector<int> y_ofs0_;           // 출력 y별 위쪽 원본 행
+  std::vector<int> y_ofs1_;           // 출력 y별 아래쪽 원본 행
+  std::vector<std::uint16_t> y_w_;    // 출력 y별 아래쪽 가중치 (0 ~ 256)
+  std::vector<std::uint16_t> row_;    // 세로 보간 결과 (원본 한 행, 16비트)
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_COLOR_RESIZE_H_
@@ -0,0 +1,166 @@
+#ifndef EYEDID_CPP_SAMPLE_DELEGATE_H_
+#define EYEDID_CPP_SAMPLE_DELEGATE_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sample {
+
+template<typename F>
+class delegate;
+
+/**
+ * delegate 클래스: 이동만 가능한 함수 객체 래퍼 (std::function 대체)
+ * - 작은 함수 객체(kBufferSize 이하, 예외 없는 이동)는 내부 버퍼에 저장하여 메모리 할당이 없음
+ * - 큰 함수 객체만 힙에 할당
+ * - 복사 불가능한 함수 객체(예: std::unique_ptr를 캡처한 람다)도 저장 가능
+ *
+ * @tparam R    함수 반환 타입
+ * @tparam Args 함수 인자 타입
+ */
+template<typename R, typename ...Args>
+class delegate<R(Args...)> {
+ public:
+  // 내부 버퍼 크기 (포인터 4개: 포인터 몇 개나 shared_ptr를 캡처한 람다가 들어감)
+  static constexpr std::size_t kBufferSize = 4 * sizeof(void*);
+
+  delegate() noexcept = default;
+  delegate(std::nullptr_t) noexcept {}
+
+  template<typename F,
+           typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, delegate>::value>::type>
+  delegate(F&& func) {
+    using functor = typename std::decay<F>::type;
+    construct<functor>(std::forward<F>(func), std::integral_constant<bool, stored_inline<functor>()>());
+  }
+
+  delegate(delegate&& other) noexcept {
+    move_from(other);
+  }
+
+  delegate& operator=(delegate&& other) noexcept {
+    if (this != &other) {
+      reset();
+      move_from(other);
+    }
+    return *this;
+  }
+
+  delegate& operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  delegate(const delegate&) = delete;
+  delegate& operator=(const delegate&) = delete;
+
+  ~delegate() { reset(); }
+
+  // 저장된 함수 호출 (비어 있으면 안 됨)
+  R operator()(Args... args) const {
+    return ops_->invoke(&storage_, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+  // 함수 객체가 메모리 할당 없이 저장되는지 확인
+  template<typename F>
+  static constexpr bool stored_inline() {
+    return sizeof(F) <= kBufferSize && alignof(F) <= alignof(storage_type) &&
+           std::is_nothrow_move_constructible<F>::value;
+  }
+
+ private:
+  using storage_type = typename std::aligned_storage<kBufferSize, alignof(std::max_align_t)>::type;
+
+  // 함수 객체 타입별 연산 테이블
+  struct operations {
+    R (*invoke)(const void* storage, Args&&... args);
+    void (*move)(void* dst, void* src); // src의 함수 객체를 dst로 옮기고 src를 정리
+    void (*destroy)(void* storage);
+  };
+
+  template<typename F>
+  struct inline_ops {
+    static F* get(const void* storage) {
+      return const_cast<F*>(static_cast<const F*>(storage));
+    }
+    static R invoke(const void* storage, Args&&... args) {
+      return (*get(storage))(std::forward<Args>(args)...);
+    }
+    static void move(void* dst, void* src) noexcept {
+      new (dst) F(std::move(*get(src)));
+      get(src)->~F();
+    }
+    static void destroy(void* storage) noexcept {
+      get(storage)->~F();
+    }
+    static constexpr operations ops{&invoke, &move, &destroy};
+  };
+
+  template<typename F>
+  struct heap_ops {
+    static F* get(const void* storage) {
+      return *static_cast<F* const*>(storage);
+    }
+    static R invoke(const void* storage, Args&&... args) {
+      return (*get(storage))(std::forward<Args>(args)...);
+    }
+    static void move(void* dst, void* src) noexcept {
+      *static_cast<F**>(dst) = get(src); // 포인터만 옮김
+    }
+    static void destroy(void* storage) noexcept {
+      delete get(storage);
+    }
+    static constexpr operations ops{&invoke, &move, &destroy};
+  };
+
+  // 내부 버퍼에 저장
+  template<typename F, typename F2>
+  void construct(F2&& func, std::true_type) {
+    new (&storage_) F(std::forward<F2>(func));
+    ops_ = &inline_ops<F>::ops;
+  }
+
+  // 힙에 할당하고 포인터만 내부 버퍼에 저장
+  template<typename F, typename F2>
+  void construct(F2&& func, std::false_type) {
+    *reinterpret_cast<F**>(&storage_) = new F(std::forward<F2>(func));
+    ops_ = &heap_ops<F>::ops;
+  }
+
+  void move_from(delegate& other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->move(&storage_, &other.storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (ops_ != nullptr) {
+      ops_->destroy(&storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  mutable storage_type storage_;      // 함수 객체 또는 힙에 할당한 함수 객체의 포인터
+  const operations* ops_ = nullptr;   // 저장된 함수 객체의 연산 테이블 (비어 있으면 nullptr)
+};
+
+template<typename R, typename ...Args>
+constexpr std::size_t delegate<R(Args...)>::kBufferSize;
+
+template<typename R, typename ...Args>
+template<typename F>
+constexpr typename delegate<R(Args...)>::operations delegate<R(Args...)>::inline_ops<F>::ops;
+
+template<typename R, typename ...Args>
+template<typename F>
+constexpr typename delegate<R(Args...)>::operations delegate<R(Args...)>::heap_ops<F>::ops;
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_DELEGATE_H_
@@ -2,11 +2,12 @@
 #define EYEDID_CPP_SAMPLE_DRAWABLES_H_
 
 #include <algorithm>
+#include <cstdint>
 #include <mutex>
-#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "opencv2/opencv.hpp"
 
@@ -16,6 +17,8 @@
  * -  (Circle, Text, Image) draw ޼带  ȭ鿡 ׷
  * - `draw` ޼ Ұ ̴(visibility) Ȯ 
  * - ü ȮϷ `draw_if` 
+ * - κ ſ: bounds() Ұ ׸ , draw(dst, clip) clip  ȿ ׸,
+ *   operator== ׷  (ٽ ׸ ʿ䰡 ) 
  */
 
 namespace sample {
@@ -34,6 +37,28 @@ struct Circle : protected DrawableBase {
     cv::circle(*dst, center, radius, color, thickness, line_type, shift);
   }
 
+  // clip  ȿ ׸ Լ (  OpenCV ߶)
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
+    auto roi = (*dst)(clip);
+    const cv::Point offset(clip.x << shift, clip.y << shift); // shiftŭ Ҽ ǥ 
+    cv::circle(roi, center - offset, radius, color, thickness, line_type, shift);
+  }
+
+  //  ׷  ( β Ƽϸ  )
+  cv::Rect bounds() const {
+    const int pad = std::max(thickness, 0) / 2 + 2;
+    const int r = (radius >> shift) + pad;
+    const cv::Point c(center.x >> shift, center.y >> shift);
+    return cv::Rect(c.x - r, c.y - r, 2 * r + 1, 2 * r + 1);
+  }
+
+  bool operator==(const Circle& other) const {
+    return visible == other.visible && center == other.center && radius == other.radius &&
+           color == other.color && thickness == other.thickness && line_type == other.line_type &&
+           shift == other.shift;
+  }
+  bool operator!=(const Circle& other) const { return !(*this == other); }
+
   cv::Point center; //  ߽ ǥ
   int radius = 10; //   (⺻: 10)
   cv::Scalar color; //   (BGR )
@@ -42,36 +67,325 @@ struct Circle : protected DrawableBase {
   int shift = 0; // Ҽ ǥ е
 };
 
+// 簢 ׸  ü (  ǥ )
+struct Rectangle : protected DrawableBase {
+  using DrawableBase::visible; // θ Ŭ visible  
+
+  // 簢 ȭ鿡 ׸ Լ
+  void draw(cv::Mat* dst) const {
+    cv::rectangle(*dst, rect, color, thickness, line_type);
+  }
+
+  // clip  ȿ ׸ Լ
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
+    auto roi = (*dst)(clip);
+    cv::rectangle(roi, cv::Rect(rect.x - clip.x, rect.y - clip.y, rect.width, rect.height), color, thickness, line_type);
+  }
+
+  // 簢 ׷  ( β  )
+  cv::Rect bounds() const {
+    const int pad = std::max(thickness, 0) / 2 + 1;
+    return cv::Rect(rect.x - pad, rect.y - pad, rect.width + 2 * pad, rect.height + 2 * pad);
+  }
+
+  bool operator==(const Rectangle& other) const {
+    return visible == other.visible && rect == other.rect && color == other.color &&
+           thickness == other.thickness && line_type == other.line_type;
+  }
+  bool operator!=(const Rectangle& other) const { return !(*this == other); }
+
+  cv::Rect rect; // 簢 
+  cv::Scalar color = { 255, 255, 255 }; //   (⺻: )
+  int thickness = 1; //  β (-1̸ θ ä)
+  int line_type = cv::LINE_8; //  
+};
+
+//  ׸  ü (ü  )
+struct Polyline : protected DrawableBase {
+  using DrawableBase::visible; // θ Ŭ visible  
+
+  //  ȭ鿡 ׸ Լ
+  void draw(cv::Mat* dst) const {
+    if (points.size() < 2) return;
+    cv::polylines(*dst, points, closed, color, thickness, line_type);
+  }
+
+  // clip  ȿ ׸ Լ
+  // - ǥ ű ӽ ۸ ϹǷ ݺ Ҵ 
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
+    if (points.size() < 2) return;
+    shifted_.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+      shifted_[i] = points[i] - clip.tl();
+    auto roi = (*dst)(clip);
+    cv::polylines(roi, shifted_, closed, color, thickness, line_type);
+  }
+
+  //   ϴ  ( β  )
+  cv::Rect bounds() const {
+    if (points.empty()) return cv::Rect();
+    int x0 = points[0].x, y0 = points[0].y, x1 = x0, y1 = y0;
+    for (const auto& p : points) {
+      x0 = std::min(x0, p.x); y0 = std::min(y0, p.y);
+      x1 = std::max(x1, p.x); y1 = std::max(y1, p.y);
+    }
+    const int pad = std::max(thickness, 0) / 2 + 2;
+    return cv::Rect(x0 - pad, y0 - pad, x1 - x0 + 2 * pad + 1, y1 - y0 + 2 * pad + 1);
+  }
+
+  bool operator==(const Polyline& other) const {
+    return visible == other.visible && points == other.points && closed == other.closed &&
+           color == other.color && thickness == other.thickness && line_type == other.line_type;
+  }
+  bool operator!=(const Polyline& other) const { return !(*this == other); }
+
+  std::vector<cv::Point> points; //   
+  bool closed = false; //   ù   
+  cv::Scalar color = { 255, 255, 255 }; //   (⺻: )
+  int thickness = 1; //  β
+  int line_type = cv::LINE_8; //  
+
+ private:
+  mutable std::vector<cv::Point> shifted_; // clip  ű ǥ (mutable: const ޼忡  )
+};
+
 // ̹ ׸  ü
 struct Image : protected DrawableBase {
   using DrawableBase::visible; // θ Ŭ visible  
 
+  Image() = default;
+
+  //   resized_  
+  // - resized_ ü   ĳ̹Ƿ ϸ ٸ 纻 ׸ ߿   
+  // -    resized_ ۸ Ͽ Ҵ 
+  Image(const Image& other)
+  : DrawableBase(other), tl(other.tl), size(other.size), buffer(other.buffer), version(other.version) {}
+  Image& operator=(const Image& other) {
+    visible = other.visible;
+    tl = other.tl;
+    size = other.size;
+    if (buffer.data != other.buffer.data)
+      resized_src_.release(); //     FramePool   ְ 
+    buffer = other.buffer;
+    version = other.version;
+    return *this;
+  }
+
   // ̹ ȭ鿡 ׸ Լ
   void draw(cv::Mat* dst) const {
+    draw(dst, cv::Rect(0, 0, dst->cols, dst->rows));
+  }
+
+  // clip  ȿ ׸ Լ
+  // - ۰ ̹ size ũ̸ ũ   ٷ  (pre-sized)
+  // -  / ٽ ׸  ũ   (۴ ڸ  ʴ´ٴ )
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
     if (buffer.empty()) return; // ̹ Ͱ  ׸ 
 
-    cv::resize(buffer, resized_, size); // ̹ ϴ ũ 
-    const auto img_w = std::min(resized_.cols, dst->cols - tl.x); // ȭ ʺ 
-    const auto img_h = std::min(resized_.rows, dst->rows - tl.y); // ȭ ̿ 
-    resized_(cv::Rect(0, 0, img_w, img_h)).copyTo((*dst)(cv::Rect(tl.x, tl.y, img_w, img_h))); // ̹ 
+    const auto area = bounds() & clip & cv::Rect(0, 0, dst->cols, dst->rows); // ȭ鿡 
+    if (area.empty()) return;
+    const auto src = cv::Rect(area.x - tl.x, area.y - tl.y, area.width, area.height);
+    if (buffer.size() == size) {
+      resized_src_.release();
+      buffer(src).copyTo((*dst)(area)); // ̹ 
+      return;
+    }
+
+    if (resized_src_.data != buffer.data || resized_version_ != version || resized_.size() != size) {
+      cv::resize(buffer, resized_, size); // ̹ ϴ ũ 
+      resized_src_ = buffer;
+      resized_version_ = version;
+    }
+    resized_(src).copyTo((*dst)(area)); // ̹ 
   }
+
+  // ̹ ׷ 
+  cv::Rect bounds() const {
+    return buffer.empty() ? cv::Rect() : cv::Rect(tl, size);
+  }
+
+  //  ()  ġ ũ ׸  
+  bool operator==(const Image& other) const {
+    return visible == other.visible && tl == other.tl && size == other.size && buffer.data == other.buffer.data &&
+           version == other.version;
+  }
+  bool operator!=(const Image& other) const { return !(*this == other); }
+
   cv::Point tl; // ̹ ׸ ġ ( )
   cv::Size size = { 100, 100 }; // ̹ ũ (⺻: 100x100)
-  cv::Mat buffer; // ̹ 
+  cv::Mat buffer; // ̹  (size ũ ̸  θ ׸  ũ   )
+  std::uint64_t version = 0; //   ( Ӹ Ű ٲ 쿡 ٽ ׸)
 
   private:
     mutable cv::Mat resized_; // ũ  ̹  (mutable: const ޼忡  )
+    mutable cv::Mat resized_src_; // resized_   ( Ͽ  ּҿ ٸ   ʰ )
+    mutable std::uint64_t resized_version_ = 0; // resized_   
+};
+
+//  ̹(BGRA) ׸  ü (: ü Ʈ)
+struct Overlay : protected DrawableBase {
+  using DrawableBase::visible; // θ Ŭ visible  
+
+  Overlay() = default;
+
+  //   scaled_   (Image::resized_  )
+  Overlay(const Overlay& other)
+  : DrawableBase(other), tl(other.tl), size(other.size), buffer(other.buffer), version(other.version) {}
+  Overlay& operator=(const Overlay& other) {
+    visible = other.visible;
+    tl = other.tl;
+    size = other.size;
+    if (buffer.data != other.buffer.data)
+      scaled_src_.release();
+    buffer = other.buffer;
+    version = other.version;
+    return *this;
+  }
+
+  // ̹ ȭ鿡 ׸ Լ
+  void draw(cv::Mat* dst) const {
+    draw(dst, cv::Rect(0, 0, dst->cols, dst->rows));
+  }
+
+  // clip  ȿ ׸ Լ
+  // - buffer(CV_8UC4)  äη ȭ  (İ 0 ȼ ǵ帮 )
+  // - ũⰡ ٸ size ÷ ΰ,  /̸ ٽ ø 
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
+    if (buffer.empty()) return;
+
+    const auto area = bounds() & clip & cv::Rect(0, 0, dst->cols, dst->rows);
+    if (area.empty()) return;
+
+    const cv::Mat* src = &buffer;
+    if (buffer.size() != size) {
+      if (scaled_src_.data != buffer.data || scaled_version_ != version || scaled_.size() != size) {
+        cv::resize(buffer, scaled_, size);
+        scaled_src_ = buffer;
+        scaled_version_ = version;
+      }
+      src = &scaled_;
+    }
+
+    for (int y = area.y; y < area.y + area.height; ++y) {
+      const std::uint8_t* s = src->ptr<std::uint8_t>(y - tl.y) + (area.x - tl.x) * 4;
+      std::uint8_t* d = dst->ptr<std::uint8_t>(y) + area.x * 3;
+      for (int x = 0; x < area.width; ++x, s += 4, d += 3) {
+        const int a = s[3];
+        if (a == 0) continue;
+        d[0] = static_cast<std::uint8_t>((d[0] * (255 - a) + s[0] * a + 127) / 255);
+        d[1] = static_cast<std::uint8_t>((d[1] * (255 - a) + s[1] * a + 127) / 255);
+        d[2] = static_cast<std::uint8_t>((d[2] * (255 - a) + s[2] * a + 127) / 255);
+      }
+    }
+  }
+
+  // ̹ ׷ 
+  cv::Rect bounds() const {
+    return buffer.empty() ? cv::Rect() : cv::Rect(tl, size);
+  }
+
+  bool operator==(const Overlay& other) const {
+    return visible == other.visible && tl == other.tl && size == other.size && buffer.data == other.buffer.data &&
+           version == other.version;
+  }
+  bool operator!=(const Overlay& other) const { return !(*this == other); }
+
+  cv::Point tl; // ׸ ġ ( )
+  cv::Size size = { 100, 100 }; // ׸ ũ
+  cv::Mat buffer; // BGRA ̹ (CV_8UC4)
+  std::uint64_t version = 0; //   ( ٲ  )
+
+  private:
+    mutable cv::Mat scaled_; // size ø ̹
+    mutable cv::Mat scaled_src_; // scaled_  
+    mutable std::uint64_t scaled_version_ = 0; // scaled_   
 };
 
 // ؽƮ ׸  ü
 struct Text : protected DrawableBase {
   using DrawableBase::visible; // θ Ŭ visible  
 
+  Text() = default;
+
+  //   glyph_   (Image::resized_  )
+  // -    glyph_ ϰ, ׸  Ű ٸ ٽ 
+  Text(const Text& other)
+  : DrawableBase(other), org(other.org), text(other.text), font_face(other.font_face), fontScale(other.fontScale),
+    color(other.color), thickness(other.thickness), line_type(other.line_type),
+    bottom_left_origin(other.bottom_left_origin), use_cache(other.use_cache) {}
+  Text& operator=(const Text& other) {
+    visible = other.visible;
+    org = other.org;
+    text = other.text;
+    font_face = other.font_face;
+    fontScale = other.fontScale;
+    color = other.color;
+    thickness = other.thickness;
+    line_type = other.line_type;
+    bottom_left_origin = other.bottom_left_origin;
+    use_cache = other.use_cache;
+    return *this;
+  }
+
   // ؽƮ ȭ鿡 ׸ Լ
   void draw(cv::Mat* dst) const {
-    cv::putText(*dst, text, org, font_face, fontScale, color, thickness, line_type, bottom_left_origin);
+    draw(dst, cv::Rect(0, 0, dst->cols, dst->rows));
   }
 
+  // clip  ȿ ׸ Լ
+  // - use_cache̸ ̸ ׷   ũ  ä  (Hershey Ʈ Ź ٽ ׸ )
+  void draw(cv::Mat* dst, const cv::Rect& clip) const {
+    if (text.empty()) return;
+    if (!use_cache || dst->type() != CV_8UC3) {
+      auto roi = (*dst)(clip);
+      cv::putText(roi, text, org - clip.tl(), font_face, fontScale, color, thickness, line_type, bottom_left_origin);
+      return;
+    }
+
+    const auto& mask = glyph();
+    const auto box = bounds();
+    const auto area = box & clip & cv::Rect(0, 0, dst->cols, dst->rows);
+    if (area.empty()) return;
+    const auto src = mask(cv::Rect(area.x - box.x, area.y - box.y, area.width, area.height));
+
+    if (line_type != cv::LINE_AA) {
+      (*dst)(area).setTo(color, src); // ũ 0/255̹Ƿ  ä putText  
+      return;
+    }
+
+    // Ƽϸ: ũ ķ Ͽ  
+    const int c[3] = {static_cast<int>(color[0]), static_cast<int>(color[1]), static_cast<int>(color[2])};
+    for (int y = 0; y < area.height; ++y) {
+      const auto* a = src.ptr<std::uint8_t>(y);
+      auto* d = dst->ptr<std::uint8_t>(area.y + y) + area.x * 3;
+      for (int x = 0; x < area.width; ++x, d += 3) {
+        const int alpha = a[x];
+        if (alpha == 0) continue;
+        for (int k = 0; k < 3; ++k)
+          d[k] = static_cast<std::uint8_t>((d[k] * (255 - alpha) + c[k] * alpha + 127) / 255);
+      }
+    }
+  }
+
+  // ؽƮ ׷  (ؼ Ʒ κа  β  )
+  cv::Rect bounds() const {
+    if (text.empty()) return cv::Rect();
+    if (use_cache) {
+      const auto& mask = glyph();
+      return cv::Rect(org.x + glyph_.offset.x, org.y + glyph_.offset.y, mask.cols, mask.rows);
+    }
+    int baseline = 0;
+    const auto size = cv::getTextSize(text, font_face, fontScale, thickness, &baseline);
+    return layout(size, baseline);
+  }
+
+  bool operator==(const Text& other) const {
+    return visible == other.visible && org == other.org && text == other.text && font_face == other.font_face &&
+           fontScale == other.fontScale && color == other.color && thickness == other.thickness &&
+           line_type == other.line_type && bottom_left_origin == other.bottom_left_origin;
+  }
+  bool operator!=(const Text& other) const { return !(*this == other); }
+
   cv::Point org; // ؽƮ  ǥ
   std::string text; // ǥ ؽƮ
   int font_face = cv::FONT_HERSHEY_PLAIN; // Ʈ 
@@ -80,6 +394,53 @@ struct Text : protected DrawableBase {
   int thickness = 1; //  β
   int line_type = cv::LINE_8; //  
   bool bottom_left_origin = false; // ǥ  (false:   )
+  bool use_cache = true; //  ũ ĳ   (false: Ź putText)
+
+ private:
+  // ĳõ  ũ ( ġ Ű  Ƿ ٲ ٽ ׸ )
+  struct Glyph {
+    std::string text;
+    int font_face = -1;
+    double scale = 0;
+    int thickness = 0;
+    int line_type = 0;
+    bool bottom_left_origin = false;
+    cv::Point offset; // org  ũ   ġ
+    cv::Mat mask;     //   (CV_8UC1, 0~255 )
+  };
+
+  //  ũκ org   
+  cv::Rect layout(cv::Size size, int baseline) const {
+    const int pad = thickness + 1;
+    const int top = bottom_left_origin ? org.y - baseline : org.y - size.height;
+    return cv::Rect(org.x - pad, top - pad, size.width + 2 * pad, size.height + baseline + 2 * pad);
+  }
+
+  // Ű(ؽƮ, Ʈ, ũ, β,  ) ٲ ũ ٽ ׸
+  const cv::Mat& glyph() const {
+    auto& g = glyph_;
+    if (!g.mask.empty() && g.text == text && g.font_face == font_face && g.scale == fontScale &&
+        g.thickness == thickness && g.line_type == line_type && g.bottom_left_origin == bottom_left_origin)
+      return g.mask;
+
+    int baseline = 0;
+    const auto size = cv::getTextSize(text, font_face, fontScale, thickness, &baseline);
+    const auto box = layout(size, baseline);
+    g.offset = cv::Point(box.x - org.x, box.y - org.y);
+    g.mask = cv::Mat(box.height, box.width, CV_8UC1, cv::Scalar(0)); //   ( ũ ڸ  )
+    cv::putText(g.mask, text, cv::Point(-g.offset.x, -g.offset.y), font_face, fontScale, cv::Scalar(255),
+                thickness, line_type, bottom_left_origin);
+
+    g.text = text;
+    g.font_face = font_face;
+    g.scale = fontScale;
+    g.thickness = thickness;
+    g.line_type = line_type;
+    g.bottom_left_origin = bottom_left_origin;
+    return g.mask;
+  }
+
+  mutable Glyph glyph_; // ׸  ĳ (mutable: const ޼忡  )
 };
 
 // Ư ü Drawable Ȯϱ  ø
@@ -102,49 +463,13 @@ draw_if(const Drawable& drawable, cv::Mat* dst) {
         drawable.draw(dst); //  ׸
 }
 
-// No-own erasure
-// Drawable Ŭ:  UI Ҹ ߻ȭ
-class Drawable {
-  struct DrawableInterface {
-    virtual void draw(cv::Mat* dst) const = 0; // Ҹ ׸ ̽
-  };
-
-  // ü Drawable ü ϴ Ŭ
-  template<typename T>
-  struct DrawableConcrete : DrawableInterface {
-    explicit DrawableConcrete(T* t) : object_(t) {}
-
-    void draw(cv::Mat* dst) const override {
-      if (object_->visible) //   
-        object_->draw(dst); //  ׸
-    }
-
-    T* object_; //  ü 
-  };
-
-  std::shared_ptr<DrawableInterface> ptr_; // Drawable ü 
-
-  template<typename T>
-  T* get_ptr() {
-    return dynamic_cast<DrawableConcrete<T>*>(ptr_.get())->object_; //  ü ȯ
-  }
-
- public:
-  Drawable() = default;
-
-  // Drawable ü 
-  template<typename T, typename std::enable_if<is_drawable<T>::value, int>::type = 0>
-  explicit Drawable(T* object) : ptr_(std::make_shared<DrawableConcrete<T>>(object)) {}
-
-  //  ü ȯ
-  template<typename T> T* get_as() { return get_ptr<T>(); }
-  template<typename T> const T* get_as() const { return get_ptr<T>(); }
-
-  // Ҹ ȭ鿡 ׸
-  void draw(cv::Mat* dst) const {
-    ptr_->draw(dst);
-  }
-};
+// Ұ  ̰ clip  ġ 쿡 clip  ȿ ׸ Լ
+template<typename Drawable>
+typename std::enable_if<is_drawable<Drawable>::value>::type
+draw_if(const Drawable& drawable, cv::Mat* dst, const cv::Rect& clip) {
+    if (drawable.visible && !(drawable.bounds() & clip).empty())
+        drawable.draw(dst, clip);
+}
 
 } // namespace drawables
 } // namespace sample
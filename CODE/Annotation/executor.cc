@@ -0,0 +1,83 @@
+#include "executor.h"
+
+#include <algorithm>
+
+namespace sample {
+
+// **LoopExecutor 클래스**
+void LoopExecutor::post(task_type task) {
+  std::lock_guard<std::mutex> lck(mutex_);
+  tasks_.emplace_back(std::move(task));
+}
+
+// 예약된 작업을 한 번에 가져온 뒤 잠금 없이 실행
+// - 작업 안에서 post()를 호출해도 교착되지 않음
+std::size_t LoopExecutor::run_pending() {
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    if (tasks_.empty())
+      return 0;
+    running_.swap(tasks_);
+  }
+
+  const auto count = running_.size();
+  for (auto& task : running_)
+    task();
+  running_.clear();
+  return count;
+}
+
+// **ThreadPoolExecutor 클래스**
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t thread_count) {
+  thread_count = std::max<std::size_t>(1, thread_count);
+  threads_.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i) {
+    threads_.emplace_back([this]() {
+      run_impl();
+    });
+  }
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+  join();
+}
+
+void ThreadPoolExecutor::post(task_type task) {
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    tasks_.emplace_back(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+void ThreadPoolExecutor::join() {
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (auto& thread : threads_) {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
+// 작업 스레드
+// - 종료 요청 후에도 큐가 빌 때까지 작업을 실행
+void ThreadPoolExecutor::run_impl() {
+  std::unique_lock<std::mutex> lck(mutex_);
+  while (true) {
+    cv_.wait(lck, [this]() { return stop_ || !tasks_.empty(); });
+    if (tasks_.empty())
+      return; // stop_ && 남은 작업 없음
+
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+    lck.unlock();
+    task();
+    lck.lock();
+  }
+}
+
+} // namespace sample
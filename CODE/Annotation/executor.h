@@ -0,0 +1,82 @@
+#ifndef EYEDID_CPP_SAMPLE_EXECUTOR_H_
+#define EYEDID_CPP_SAMPLE_EXECUTOR_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "delegate.h"
+
+namespace sample {
+
+/**
+ * Executor 클래스:
+ * - 작업을 다른 스레드에서 실행하기 위한 인터페이스
+ * - signal<>::connect에 전달하면 슬롯이 발행 스레드가 아닌 실행기에서 호출됨 (queued connection)
+ * - post()는 어느 스레드에서나 호출 가능해야 함
+ */
+class Executor {
+ public:
+  using task_type = delegate<void()>; // 이동 전용 작업 타입
+
+  virtual ~Executor() = default;
+
+  // 작업 예약 (바로 반환)
+  virtual void post(task_type task) = 0;
+};
+
+/**
+ * LoopExecutor 클래스:
+ * - 기존 루프(예: GUI 그리기 루프)가 run_pending()을 호출할 때 작업을 실행하는 실행기
+ * - 소멸 시 실행되지 않은 작업은 버림
+ */
+class LoopExecutor : public Executor {
+ public:
+  void post(task_type task) override;
+
+  /**
+   * 예약된 작업 실행 (루프 스레드에서 호출)
+   * - 실행 중에 새로 예약된 작업은 다음 호출에서 실행
+   * @return 실행한 작업 수
+   */
+  std::size_t run_pending();
+
+ private:
+  std::mutex mutex_;
+  std::vector<task_type> tasks_;   // 예약된 작업
+  std::vector<task_type> running_; // 실행 중인 작업 (루프 스레드 전용, 용량 재사용)
+};
+
+/**
+ * ThreadPoolExecutor 클래스:
+ * - 고정된 개수의 작업 스레드에서 작업을 실행하는 실행기
+ * - join() 또는 소멸 시 남은 작업을 모두 실행한 뒤 스레드를 종료
+ */
+class ThreadPoolExecutor : public Executor {
+ public:
+  explicit ThreadPoolExecutor(std::size_t thread_count = 1);
+  ~ThreadPoolExecutor() override;
+
+  ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+  ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+  void post(task_type task) override;
+
+  void join(); // 남은 작업 실행 후 스레드 종료 대기
+
+ private:
+  void run_impl(); // 작업 스레드 실행 로직
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<task_type> tasks_;
+  bool stop_ = false;
+  std::vector<std::thread> threads_;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_EXECUTOR_H_
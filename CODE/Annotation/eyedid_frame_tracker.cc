@@ -0,0 +1,55 @@
+#include "eyedid_frame_tracker.h"
+
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "tracker_manager.h"
+
+namespace sample {
+
+int EyedidFrameTracker::initialize(const std::string& license_key, const EyedidTrackerOptions& options) {
+  const auto code = gaze_tracker_.initialize(license_key, options); // 트래커 초기화
+  if (code != 0)
+    return code;
+
+  gaze_tracker_.setFaceDistance(60); // 얼굴과 카메라 간 거리 설정
+  return 0;
+}
+
+void EyedidFrameTracker::setTrackingCallback(eyedid::ITrackingCallback* callback) {
+  gaze_tracker_.setTrackingCallback(callback);
+}
+
+void EyedidFrameTracker::setCalibrationCallback(eyedid::ICalibrationCallback* callback) {
+  gaze_tracker_.setCalibrationCallback(callback);
+}
+
+bool EyedidFrameTracker::addFrame(std::int64_t timestamp, const std::uint8_t* rgb, int width, int height) {
+  return gaze_tracker_.addFrame(timestamp, rgb, width, height);
+}
+
+void EyedidFrameTracker::startCollectSamples() {
+  gaze_tracker_.startCollectSamples();
+}
+
+/**
+ * Gaze Tracker 초기화
+ * - SDK를 쓰는 유일한 초기화 경로이므로 tracker_manager.cc가 아닌 이 파일에 정의
+ *   (SDK 없이 빌드할 때 TrackerManager가 SDK 심볼을 참조하지 않도록 함)
+ * @param license_key 인증 키
+ * @param options 트래커 옵션
+ * @return 초기화 성공 여부
+ */
+bool TrackerManager::initialize(const std::string &license_key, const EyedidTrackerOptions& options) {
+  std::unique_ptr<EyedidFrameTracker> tracker(new EyedidFrameTracker());
+  const auto code = tracker->initialize(license_key, options);
+  if (code != 0) {
+    std::cerr << "Failed to authenticate (code: " << code << " )\n"; // 오류 출력
+    return false;
+  }
+
+  return initialize(std::move(tracker)); // 추적/캘리브레이션 콜백 연결
+}
+
+} // namespace sample
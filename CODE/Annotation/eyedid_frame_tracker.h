@@ -0,0 +1,44 @@
+#ifndef EYEDID_CPP_SAMPLE_EYEDID_FRAME_TRACKER_H_
+#define EYEDID_CPP_SAMPLE_EYEDID_FRAME_TRACKER_H_
+
+#include <cstdint>
+#include <string>
+
+#include "eyedid/gaze_tracker.h"
+#include "frame_tracker.h"
+
+namespace sample {
+
+/**
+ * EyedidFrameTracker 클래스:
+ * - eyedid::GazeTracker(SDK)를 FrameTracker로 감싼 추적기
+ * - TrackerManager::initialize(license_key, options)에서만 생성 (TrackerManager는 SDK 객체를 직접 갖지 않음)
+ * - GazeTracker를 쓰는 코드는 이 파일(eyedid_frame_tracker.cc)에만 있으므로,
+ *   이 파일을 빼고 빌드하면 SDK 추적기와 라이선스 없이 StubGazeTracker로 실행할 수 있음 (bench/)
+ *   (창 위치 함수 eyedid::getWindowRect 때문에 SDK 라이브러리 링크는 여전히 필요)
+ */
+class EyedidFrameTracker : public FrameTracker {
+ public:
+  EyedidFrameTracker() = default;
+
+  /**
+   * 라이선스 인증 및 SDK 초기화
+   * @return SDK 오류 코드 (0이면 성공)
+   */
+  int initialize(const std::string& license_key, const EyedidTrackerOptions& options);
+
+  void setTrackingCallback(eyedid::ITrackingCallback* callback) override;
+  void setCalibrationCallback(eyedid::ICalibrationCallback* callback) override;
+  bool addFrame(std::int64_t timestamp, const std::uint8_t* rgb, int width, int height) override;
+  void startCollectSamples() override;
+
+  // 캘리브레이션 시작, 주의 영역 설정 등 FrameTracker에 없는 SDK 기능
+  eyedid::GazeTracker& sdk() { return gaze_tracker_; }
+
+ private:
+  eyedid::GazeTracker gaze_tracker_;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_EYEDID_FRAME_TRACKER_H_
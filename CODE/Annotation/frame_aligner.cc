@@ -0,0 +1,74 @@
+#include "frame_aligner.h"
+
+#include <algorithm>
+
+namespace sample {
+
+FrameAligner::FrameAligner(std::size_t sources, std::int64_t tolerance_ns, std::size_t depth)
+: tolerance_ns_(std::max<std::int64_t>(tolerance_ns, 0)),
+  depth_(std::max<std::size_t>(depth, 1)),
+  queues_(sources) {}
+
+bool FrameAligner::push(std::size_t index, const FrameEnvelope& envelope, std::vector<FrameEnvelope>* set) {
+  set->clear();
+  if (index >= queues_.size())
+    return false;
+
+  std::lock_guard<std::mutex> lck(mutex_);
+  auto& queue = queues_[index];
+  queue.push_back(envelope);
+  if (queue.size() > depth_) { // 다른 카메라가 멈췄거나 크게 늦음
+    queue.pop_front();
+    unaligned_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return try_align(set);
+}
+
+void FrameAligner::clear() {
+  std::lock_guard<std::mutex> lck(mutex_);
+  for (auto& queue : queues_)
+    queue.clear();
+}
+
+FrameAligner::Stats FrameAligner::stats() const {
+  Stats stats;
+  stats.aligned = aligned_.load(std::memory_order_relaxed);
+  stats.unaligned = unaligned_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 가장 오래된 프레임들의 기준 시각을 구해 너무 이른 프레임을 버리는 것을 반복
+// - 버린 프레임이 없으면 모든 카메라의 가장 오래된 프레임이 [기준 - tolerance, 기준] 안에 있음
+bool FrameAligner::try_align(std::vector<FrameEnvelope>* set) {
+  if (queues_.empty())
+    return false;
+
+  while (true) {
+    std::int64_t target = 0;
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      if (queues_[i].empty())
+        return false; // 아직 프레임이 오지 않은 카메라가 있음
+      target = i == 0 ? queues_[i].front().capture_ns : std::max(target, queues_[i].front().capture_ns);
+    }
+
+    bool dropped = false;
+    for (auto& queue : queues_) {
+      while (!queue.empty() && queue.front().capture_ns < target - tolerance_ns_) {
+        queue.pop_front();
+        unaligned_.fetch_add(1, std::memory_order_relaxed);
+        dropped = true;
+      }
+    }
+    if (dropped)
+      continue;
+
+    for (auto& queue : queues_) {
+      set->push_back(queue.front());
+      queue.pop_front();
+    }
+    aligned_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+}
+
+} // namespace sample
@@ -0,0 +1,71 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_ALIGNER_H_
+#define EYEDID_CPP_SAMPLE_FRAME_ALIGNER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "frame_envelope.h"
+
+namespace sample {
+
+/**
+ * FrameAligner 클래스:
+ * - 여러 카메라의 프레임을 캡처 시각(FrameEnvelope::capture_ns)으로 맞춰 같은 순간의 프레임 묶음을 만듦
+ * - 카메라마다 최근 프레임 depth개를 보관하고, 모든 카메라의 가장 오래된 프레임이
+ *   tolerance 안에 모이면 한 묶음으로 꺼냄
+ *   - 기준 시각은 각 카메라의 가장 오래된 프레임 중 가장 늦은 것
+ *   - 기준 시각보다 tolerance 이상 이른 프레임은 짝이 나올 수 없으므로 버림 (unaligned)
+ * - 카메라들이 같은 시계(steady_clock)를 써야 함 (장치 타임스탬프는 V4L2 CLOCK_MONOTONIC)
+ * - push()는 여러 카메라 스레드에서 동시에 호출 가능
+ * - 보관 중인 프레임은 카메라의 FramePool 버퍼를 참조하므로 풀 크기에 depth를 더해야 함
+ */
+class FrameAligner {
+ public:
+  struct Stats {
+    std::uint64_t aligned = 0;   // 만든 묶음 수
+    std::uint64_t unaligned = 0; // 짝을 찾지 못해 버린 프레임 수
+  };
+
+  /**
+   * @param sources      카메라 수 (push()의 index 범위)
+   * @param tolerance_ns 한 묶음 안의 캡처 시각 차이 허용 범위 (ns)
+   * @param depth        카메라별 보관 프레임 수 (최소 1)
+   */
+  FrameAligner(std::size_t sources, std::int64_t tolerance_ns, std::size_t depth);
+
+  FrameAligner(const FrameAligner&) = delete;
+  FrameAligner& operator=(const FrameAligner&) = delete;
+
+  /**
+   * 프레임 추가
+   * @param index    카메라 번호 (0 ~ sources-1)
+   * @param envelope 프레임 (픽셀 데이터는 참조만 보관)
+   * @param set      묶음이 만들어지면 카메라 번호 순으로 채움 (기존 내용은 지움)
+   * @return 묶음을 만들었으면 true
+   */
+  bool push(std::size_t index, const FrameEnvelope& envelope, std::vector<FrameEnvelope>* set);
+
+  void clear(); // 보관 중인 프레임을 모두 버림 (통계는 유지)
+
+  Stats stats() const;
+
+ private:
+  bool try_align(std::vector<FrameEnvelope>* set); // mutex_를 잡은 상태에서 호출
+
+  const std::int64_t tolerance_ns_;
+  const std::size_t depth_;
+
+  std::mutex mutex_;
+  std::vector<std::deque<FrameEnvelope>> queues_; // 카메라별 프레임 (캡처 순)
+
+  std::atomic<std::uint64_t> aligned_{0};
+  std::atomic<std::uint64_t> unaligned_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_ALIGNER_H_
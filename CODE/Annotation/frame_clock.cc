@@ -0,0 +1,44 @@
+#include "frame_clock.h"
+
+#include <thread>
+
+namespace sample {
+
+FrameClock::FrameClock(std::chrono::microseconds period, Mode mode)
+: period_(period), mode_(mode) {
+  reset();
+}
+
+void FrameClock::reset() {
+  start_ = clock::now();
+  next_ = start_ + period_;
+  stats_ = Stats();
+}
+
+std::uint64_t FrameClock::wait() {
+  ++stats_.ticks;
+  if (mode_ == Mode::kUnpaced)
+    return stats_.ticks;
+
+  const auto now = clock::now();
+  if (now < next_) {
+    std::this_thread::sleep_until(next_);
+    next_ += period_;
+  } else {
+    // 주기를 넘겼으면 밀린 tick을 몰아서 실행하지 않고 현재 시각부터 다시 맞춤
+    const auto overrun_us = std::chrono::duration_cast<std::chrono::microseconds>(now - next_).count();
+    ++stats_.overruns;
+    if (overrun_us > stats_.max_overrun_us)
+      stats_.max_overrun_us = overrun_us;
+    next_ = now + period_;
+  }
+  return stats_.ticks;
+}
+
+FrameClock::clock::duration FrameClock::elapsed() const {
+  if (mode_ == Mode::kUnpaced)
+    return std::chrono::duration_cast<clock::duration>(period_ * static_cast<std::int64_t>(stats_.ticks));
+  return clock::now() - start_;
+}
+
+} // namespace sample
@@ -0,0 +1,65 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_CLOCK_H_
+#define EYEDID_CPP_SAMPLE_FRAME_CLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace sample {
+
+/**
+ * FrameClock 클래스:
+ * - 메인(그리기) 루프의 주기를 정하는 시계 (waitKey 대기 시간 대신 사용)
+ * - kRealtime: 시작 시각 기준으로 다음 주기까지 대기 (늦어지면 따라잡지 않고 다시 맞춤)
+ * - kUnpaced: 기다리지 않음. elapsed()는 실제 시간 대신 "tick 수 x 주기"의 가상 시간을 반환하여
+ *   CI/벤치마크에서 최대 속도로 돌리면서도 시간에 의존하는 로직을 같은 결과로 재현
+ * - 한 스레드에서만 사용
+ */
+class FrameClock {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  enum class Mode {
+    kRealtime,
+    kUnpaced,
+  };
+
+  // 시계 통계
+  struct Stats {
+    std::uint64_t ticks = 0;         // wait() 호출 수
+    std::uint64_t overruns = 0;      // 주기 안에 루프가 끝나지 않은 횟수 (kRealtime)
+    std::int64_t max_overrun_us = 0; // 최대 초과 시간 (us)
+  };
+
+  explicit FrameClock(std::chrono::microseconds period = std::chrono::microseconds(10000),
+                      Mode mode = Mode::kRealtime);
+
+  /**
+   * 다음 주기까지 대기
+   * @return 지금까지의 tick 수
+   */
+  std::uint64_t wait();
+
+  void reset(); // 시작 시각을 현재로 다시 설정
+
+  // 시작부터의 경과 시간 (kUnpaced면 가상 시간)
+  clock::duration elapsed() const;
+
+  std::chrono::microseconds period() const { return period_; }
+
+  // 지금 받은 값이 화면에 표시될 때까지의 예상 지연 (다음 tick까지 평균 반 주기 + 그린 화면이 표시될 때까지 한 주기)
+  std::chrono::microseconds present_delay() const { return period_ + period_ / 2; }
+  Mode mode() const { return mode_; }
+
+  Stats stats() const { return stats_; }
+
+ private:
+  std::chrono::microseconds period_;
+  Mode mode_;
+  clock::time_point start_;
+  clock::time_point next_;
+  Stats stats_;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_CLOCK_H_
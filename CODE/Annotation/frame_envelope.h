@@ -0,0 +1,32 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_ENVELOPE_H_
+#define EYEDID_CPP_SAMPLE_FRAME_ENVELOPE_H_
+
+#include <cstdint>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * 카메라 프레임과 캡처 정보 (CameraThread::on_frame_ → LatestFrameFeed → TrackerManager::addFrame)
+ * - SDK 결과(GazeSample)를 만든 원본 프레임을 sequence/source_id로 찾을 수 있음
+ * - 복사해도 픽셀 데이터는 공유됨 (cv::Mat 참조)
+ */
+struct FrameEnvelope {
+  cv::Mat frame;                   // 프레임 (CameraThread에서는 BGR, addFrame에 넘길 때는 RGB)
+  std::int64_t capture_ns = 0;     // 캡처 시각 (steady_clock, ns)
+  std::uint64_t sequence = 0;      // 소스별 프레임 번호 (1부터, 건너뛴 프레임도 번호를 차지하므로 빈 번호는 드롭)
+  std::uint32_t source_id = 0;     // 프레임 소스 번호 (CameraThread 생성 시 지정)
+  bool hardware_timestamp = false; // capture_ns가 장치(V4L2 등)의 타임스탬프인지 (아니면 read() 직후 시각)
+
+  // 소스와 번호를 합친 프레임 식별자 (지연 추적용, 0이면 없음)
+  std::uint64_t trace_id() const { return make_trace_id(source_id, sequence); }
+
+  static std::uint64_t make_trace_id(std::uint32_t source_id, std::uint64_t sequence) {
+    return sequence == 0 ? 0 : (static_cast<std::uint64_t>(source_id & 0x7FFF) << 48) | (sequence & ((std::uint64_t{1} << 48) - 1));
+  }
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_ENVELOPE_H_
@@ -0,0 +1,69 @@
+#include "frame_pool.h"
+
+#include <algorithm>
+
+namespace sample {
+
+constexpr std::size_t FramePool::kDefaultDepth;
+
+FramePool::FramePool(std::size_t depth) {
+  resize(depth);
+}
+
+// 버퍼 개수 변경
+// - 줄어든 버퍼 중 외부에서 참조 중인 것은 cv::Mat 참조 카운트에 의해 나중에 해제됨
+void FramePool::resize(std::size_t depth) {
+  buffers_.resize(std::max<std::size_t>(depth, 1));
+  next_ %= buffers_.size();
+}
+
+// 비어 있는 버퍼 탐색
+// - 직전에 내보낸 버퍼 다음부터 순서대로 확인하여 가장 오래된 버퍼부터 재사용
+cv::Mat* FramePool::acquire() {
+  const auto n = buffers_.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    auto& buffer = buffers_[(next_ + i) % n];
+    if (in_use(buffer))
+      continue;
+
+    next_ = (next_ + i + 1) % n;
+    acquired_data_ = buffer.data;
+    return &buffer;
+  }
+
+  drops_.fetch_add(1, std::memory_order_relaxed); // 모든 버퍼가 사용 중
+  return nullptr;
+}
+
+// 프레임을 채운 버퍼 확인
+// - 버퍼 주소가 그대로면 재사용(hit), 바뀌었으면 새로 할당된 것(miss)
+void FramePool::commit(const cv::Mat* buffer) {
+  if (acquired_data_ != nullptr && buffer->data == acquired_data_)
+    hits_.fetch_add(1, std::memory_order_relaxed);
+  else
+    misses_.fetch_add(1, std::memory_order_relaxed);
+  acquired_data_ = nullptr;
+}
+
+FramePool::Stats FramePool::stats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.drops = drops_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void FramePool::reset_stats() {
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+  drops_.store(0, std::memory_order_relaxed);
+}
+
+// 풀이 가진 참조 외에 다른 참조가 남아 있으면 사용 중
+// - 다른 스레드가 CV_XADD로 refcount를 줄이므로 같은 원자 연산(0 더하기)으로 읽음
+//   (일반 읽기는 데이터 경쟁이며, 마지막 참조를 놓은 스레드의 쓰기가 보인다는 보장도 없음)
+bool FramePool::in_use(const cv::Mat& buffer) {
+  return buffer.u != nullptr && CV_XADD(&buffer.u->refcount, 0) > 1;
+}
+
+} // namespace sample
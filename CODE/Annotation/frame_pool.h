@@ -0,0 +1,74 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_POOL_H_
+#define EYEDID_CPP_SAMPLE_FRAME_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * FramePool 클래스:
+ * - 고정된 개수의 cv::Mat 버퍼를 돌려 쓰면서 프레임마다 발생하는 메모리 할당을 없앰
+ * - 버퍼가 해제되었는지는 cv::Mat 자체의 참조 카운트로 판단
+ *   (풀 외부의 모든 슬롯이 프레임을 놓아야 해당 버퍼를 다시 사용)
+ * - acquire()/commit()/resize()는 한 스레드(카메라 스레드)에서만 호출해야 함
+ * - stats()는 어느 스레드에서나 호출 가능
+ */
+class FramePool {
+ public:
+  // 풀 사용 통계
+  struct Stats {
+    std::uint64_t hits = 0;   // 기존 버퍼를 재할당 없이 재사용한 횟수
+    std::uint64_t misses = 0; // 버퍼를 새로 할당해야 했던 횟수
+    std::uint64_t drops = 0;  // 모든 버퍼가 사용 중이라 프레임을 버린 횟수
+  };
+
+  static constexpr std::size_t kDefaultDepth = 8; // 기본 버퍼 개수 (FrameRing 슬롯 + 처리 중인 프레임)
+
+  explicit FramePool(std::size_t depth = kDefaultDepth);
+
+  /**
+   * 버퍼 개수 변경
+   * - 외부에서 아직 참조 중인 버퍼는 참조가 끝날 때 해제됨
+   * @param depth 새 버퍼 개수 (최소 1)
+   */
+  void resize(std::size_t depth);
+
+  // 현재 버퍼 개수
+  std::size_t depth() const { return buffers_.size(); }
+
+  /**
+   * 비어 있는 버퍼를 가져옴
+   * @return 사용 가능한 버퍼, 모든 버퍼가 사용 중이면 nullptr (drops 증가)
+   */
+  cv::Mat* acquire();
+
+  /**
+   * acquire()로 얻은 버퍼에 프레임을 채운 뒤 호출
+   * - 버퍼가 재할당되었는지 확인하여 hits/misses 기록
+   */
+  void commit(const cv::Mat* buffer);
+
+  Stats stats() const; // 통계 반환
+  void reset_stats();  // 통계 초기화
+
+ private:
+  // 풀 외부에서 버퍼를 참조하고 있는지 확인
+  static bool in_use(const cv::Mat& buffer);
+
+  std::vector<cv::Mat> buffers_; // 재사용할 프레임 버퍼
+  std::size_t next_ = 0;         // 다음 탐색 시작 위치 (라운드 로빈)
+  const void* acquired_data_ = nullptr; // acquire() 시점의 버퍼 주소 (재할당 판별용)
+
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+  std::atomic<std::uint64_t> drops_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_POOL_H_
@@ -0,0 +1,246 @@
+#include "frame_ring.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace sample {
+
+constexpr std::size_t FrameRing::kDefaultCapacity;
+
+// 현재 시각 (steady_clock, ns)
+static std::int64_t now_ns() {
+  using clock = std::chrono::steady_clock;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+}
+
+// 원자 변수를 더 큰 값으로 갱신
+template<typename T>
+static void store_max(std::atomic<T>& target, T value) {
+  auto current = target.load(std::memory_order_relaxed);
+  while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+// ==== FrameRing::Consumer ====
+
+FrameRing::Consumer::Consumer(FrameRing& ring, std::string name, DropPolicy policy, std::size_t depth)
+: ring_(ring),
+  name_(std::move(name)),
+  policy_(policy),
+  depth_(std::max<std::size_t>(depth, 1)),
+  next_(ring.head_.load() + 1) {}
+
+// 정책에 따라 읽을 시퀀스 번호 결정
+// - kBlock 이외의 정책은 생산자가 다음에 덮어쓸 슬롯을 건너뛰어 복사 실패를 줄임
+std::uint64_t FrameRing::Consumer::select(std::uint64_t head) const {
+  const auto next = next_.load(std::memory_order_relaxed);
+
+  if (policy_ == DropPolicy::kBlock)
+    return next; // 생산자가 기다려 주므로 슬롯이 덮어쓰이지 않음
+
+  std::uint64_t seq = head;
+  if (policy_ == DropPolicy::kNDeep)
+    seq = head >= next + depth_ ? head - depth_ + 1 : next;
+
+  const auto capacity = ring_.slots_.size();
+  const auto oldest = head + 2 > capacity ? head + 2 - capacity : 1;
+  return std::min(std::max(seq, oldest), head);
+}
+
+// 다음 프레임 읽기
+// - 헤더를 복사하는 동안 슬롯이 덮어쓰이면 최신 head 기준으로 다시 시도
+bool FrameRing::Consumer::read(cv::Mat* frame, std::chrono::milliseconds timeout) {
+  const auto next = next_.load(std::memory_order_relaxed);
+  if (!ring_.wait_for_frame(next, timeout))
+    return false;
+
+  while (true) {
+    const auto head = ring_.head_.load(std::memory_order_acquire);
+    const auto seq = select(head);
+
+    std::int64_t publish_ns = 0;
+    if (!ring_.copy_slot(seq, frame, &publish_ns))
+      continue;
+
+    next_.store(seq + 1, std::memory_order_release);
+    if (policy_ == DropPolicy::kBlock)
+      ring_.notify_consumed();
+
+    const auto latency_us = (now_ns() - publish_ns) / 1000;
+    consumed_.fetch_add(1, std::memory_order_relaxed);
+    dropped_.fetch_add(seq - next, std::memory_order_relaxed);
+    lag_.store(head - seq, std::memory_order_relaxed);
+    store_max(max_lag_, head - seq);
+    last_latency_us_.store(latency_us, std::memory_order_relaxed);
+    store_max(max_latency_us_, latency_us);
+    return true;
+  }
+}
+
+FrameRing::ConsumerStats FrameRing::Consumer::stats() const {
+  ConsumerStats stats;
+  stats.consumed = consumed_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.lag = lag_.load(std::memory_order_relaxed);
+  stats.max_lag = max_lag_.load(std::memory_order_relaxed);
+  stats.last_latency_us = last_latency_us_.load(std::memory_order_relaxed);
+  stats.max_latency_us = max_latency_us_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// ==== FrameRing ====
+
+FrameRing::FrameRing(std::size_t capacity)
+: slots_(std::max<std::size_t>(capacity, 1)) {}
+
+std::shared_ptr<FrameRing::Consumer> FrameRing::subscribe(std::string name, DropPolicy policy,
+                                                          std::size_t depth) {
+  std::lock_guard<std::mutex> lck(consumers_mutex_);
+  auto consumer = std::make_shared<Consumer>(*this, std::move(name), policy, depth);
+  consumers_.push_back(consumer);
+  if (policy == DropPolicy::kBlock)
+    ++blocking_consumers_;
+  return consumer;
+}
+
+void FrameRing::unsubscribe(const std::shared_ptr<Consumer>& consumer) {
+  {
+    std::lock_guard<std::mutex> lck(consumers_mutex_);
+    auto it = std::find(consumers_.begin(), consumers_.end(), consumer);
+    if (it == consumers_.end())
+      return;
+    consumers_.erase(it);
+    if (consumer->policy() == DropPolicy::kBlock)
+      --blocking_consumers_;
+  }
+  notify_consumed(); // 이 소비자를 기다리던 생산자를 깨움
+}
+
+// 프레임 발행
+// 1. kBlock 소비자가 덮어쓸 슬롯을 읽을 때까지 대기
+// 2. 슬롯을 쓰기 상태(seq = 0)로 바꾸고 헤더를 복사 중인 소비자가 빠져나갈 때까지 대기
+// 3. 프레임 헤더를 저장한 뒤 시퀀스 번호를 공개
+void FrameRing::publish(const cv::Mat& frame) {
+  const auto seq = head_.load(std::memory_order_relaxed) + 1;
+  if (blocking_consumers_.load(std::memory_order_acquire) > 0)
+    wait_for_blocking_consumers(seq);
+
+  auto& slot = slots_[seq % slots_.size()];
+  slot.seq.store(0);
+  while (slot.readers.load() != 0)
+    std::this_thread::yield(); // 소비자는 헤더 복사 동안만 머무름
+
+  slot.frame = frame; // 이전 프레임의 참조가 해제되어 풀 버퍼가 반환됨
+  slot.publish_ns = now_ns();
+  slot.seq.store(seq, std::memory_order_release);
+  head_.store(seq);
+
+  if (frame_waiters_.load() > 0) {
+    { std::lock_guard<std::mutex> lck(wait_mutex_); } // 대기 직전의 소비자가 알림을 놓치지 않도록 함
+    frame_cv_.notify_all();
+  }
+}
+
+void FrameRing::close() {
+  closed_ = true;
+  {
+    std::lock_guard<std::mutex> lck(wait_mutex_);
+  }
+  frame_cv_.notify_all();
+  space_cv_.notify_all();
+}
+
+// 슬롯의 프레임 헤더 복사
+// - readers를 먼저 올린 뒤 seq를 확인하므로, seq가 일치하면 복사가 끝날 때까지 생산자가 덮어쓰지 않음
+bool FrameRing::copy_slot(std::uint64_t seq, cv::Mat* frame, std::int64_t* publish_ns) {
+  auto& slot = slots_[seq % slots_.size()];
+  slot.readers.fetch_add(1);
+  const bool valid = slot.seq.load() == seq;
+  if (valid) {
+    *frame = slot.frame;
+    *publish_ns = slot.publish_ns;
+  }
+  slot.readers.fetch_sub(1, std::memory_order_release);
+  return valid;
+}
+
+void FrameRing::wait_for_blocking_consumers(std::uint64_t seq) {
+  const auto capacity = slots_.size();
+  const auto ready = [&]() -> bool {
+    if (closed_)
+      return true;
+    std::lock_guard<std::mutex> lck(consumers_mutex_);
+    for (const auto& consumer : consumers_) {
+      if (consumer->policy() == DropPolicy::kBlock &&
+          seq >= consumer->next_.load(std::memory_order_acquire) + capacity)
+        return false;
+    }
+    return true;
+  };
+
+  std::unique_lock<std::mutex> lck(wait_mutex_);
+  while (!ready()) // 알림을 놓치더라도 주기적으로 다시 확인
+    space_cv_.wait_for(lck, std::chrono::milliseconds(10));
+}
+
+bool FrameRing::wait_for_frame(std::uint64_t seq, std::chrono::milliseconds timeout) {
+  if (closed_)
+    return false;
+  if (head_.load() >= seq)
+    return true;
+
+  std::unique_lock<std::mutex> lck(wait_mutex_);
+  ++frame_waiters_;
+  frame_cv_.wait_for(lck, timeout, [&]() -> bool {
+    return closed_ || head_.load() >= seq;
+  });
+  --frame_waiters_;
+  return !closed_ && head_.load() >= seq;
+}
+
+void FrameRing::notify_consumed() {
+  {
+    std::lock_guard<std::mutex> lck(wait_mutex_);
+  }
+  space_cv_.notify_one();
+}
+
+// ==== FrameConsumerThread ====
+
+FrameConsumerThread::FrameConsumerThread(FrameRing& ring, std::string name, FrameRing::DropPolicy policy,
+                                         callback_type callback, std::size_t depth)
+: ring_(ring),
+  consumer_(ring.subscribe(std::move(name), policy, depth)),
+  callback_(std::move(callback)) {
+  thread_ = std::thread([this]() {
+    run_impl();
+  });
+}
+
+FrameConsumerThread::~FrameConsumerThread() {
+  join();
+}
+
+void FrameConsumerThread::join() {
+  stop_.store(true, std::memory_order_release);
+  if (thread_.joinable()) {
+    thread_.join();
+    ring_.unsubscribe(consumer_);
+  }
+}
+
+// 프레임을 읽어 콜백 호출
+// - 콜백이 끝나면 참조를 바로 놓아 풀 버퍼가 재사용될 수 있도록 함
+void FrameConsumerThread::run_impl() {
+  cv::Mat frame;
+  while (!stop_.load(std::memory_order_acquire)) {
+    if (!consumer_->read(&frame, std::chrono::milliseconds(100))) {
+      if (ring_.closed())
+        break;
+      continue;
+    }
+    callback_(frame);
+    frame.release();
+  }
+}
+
+} // namespace sample
@@ -0,0 +1,187 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_RING_H_
+#define EYEDID_CPP_SAMPLE_FRAME_RING_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * FrameRing 클래스:
+ * - 카메라 스레드(생산자 1개)가 발행한 프레임을 여러 소비자가 각자의 스레드에서 읽는 링 버퍼
+ * - 각 슬롯은 프레임 헤더(cv::Mat)만 보관하며, 픽셀 데이터는 참조 카운트로 공유됨
+ * - 프레임 읽기/쓰기 경로에는 잠금이 없음 (소비자 대기와 kBlock 소비자 대기에만 조건 변수 사용)
+ * - 슬롯이 프레임을 참조하는 동안 FramePool 버퍼는 재사용되지 않으므로
+ *   FramePool 크기는 링 용량보다 커야 함
+ */
+class FrameRing {
+ public:
+  // 소비자별 프레임 드롭 정책
+  enum class DropPolicy {
+    kLatestOnly, // 항상 가장 최신 프레임만 읽고 밀린 프레임은 버림
+    kBlock,      // 모든 프레임을 순서대로 읽음 (소비자가 밀리면 생산자가 기다림)
+    kNDeep,      // 최대 N 프레임까지 밀리는 것을 허용하고 초과분은 버림
+  };
+
+  // 소비자별 지연(lag) 통계
+  struct ConsumerStats {
+    std::uint64_t consumed = 0;       // 읽은 프레임 수
+    std::uint64_t dropped = 0;        // 정책에 의해 건너뛴 프레임 수
+    std::uint64_t lag = 0;            // 마지막으로 읽을 때 밀려 있던 프레임 수
+    std::uint64_t max_lag = 0;        // 최대 밀린 프레임 수
+    std::int64_t last_latency_us = 0; // 마지막 프레임의 발행 → 읽기 지연 (us)
+    std::int64_t max_latency_us = 0;  // 최대 발행 → 읽기 지연 (us)
+  };
+
+  /**
+   * Consumer 클래스:
+   * - subscribe()로 생성되며 한 스레드에서만 read()를 호출해야 함
+   * - FrameRing보다 오래 사용하면 안 됨
+   */
+  class Consumer {
+   public:
+    Consumer(FrameRing& ring, std::string name, DropPolicy policy, std::size_t depth);
+
+    /**
+     * 정책에 따라 다음 프레임을 읽음
+     * @param frame   읽은 프레임을 저장할 위치 (픽셀 데이터는 복사하지 않음)
+     * @param timeout 새 프레임을 기다릴 최대 시간
+     * @return 프레임을 읽었으면 true, 시간 초과 또는 링이 닫혔으면 false
+     */
+    bool read(cv::Mat* frame, std::chrono::milliseconds timeout);
+
+    ConsumerStats stats() const;
+    const std::string& name() const { return name_; }
+    DropPolicy policy() const { return policy_; }
+
+   private:
+    friend class FrameRing;
+
+    // 정책에 따라 다음에 읽을 시퀀스 번호를 결정
+    std::uint64_t select(std::uint64_t head) const;
+
+    FrameRing& ring_;
+    const std::string name_;
+    const DropPolicy policy_;
+    const std::size_t depth_;
+    std::atomic<std::uint64_t> next_; // 다음에 읽을 시퀀스 번호 (kBlock 정책에서 생산자가 참조)
+
+    std::atomic<std::uint64_t> consumed_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> lag_{0};
+    std::atomic<std::uint64_t> max_lag_{0};
+    std::atomic<std::int64_t> last_latency_us_{0};
+    std::atomic<std::int64_t> max_latency_us_{0};
+  };
+
+  static constexpr std::size_t kDefaultCapacity = 4; // 기본 슬롯 개수
+
+  explicit FrameRing(std::size_t capacity = kDefaultCapacity);
+
+  FrameRing(const FrameRing&) = delete;
+  FrameRing& operator=(const FrameRing&) = delete;
+
+  /**
+   * 소비자 등록
+   * - 등록 이후에 발행된 프레임부터 읽음
+   * @param name   통계 출력용 이름
+   * @param policy 드롭 정책
+   * @param depth  kNDeep 정책에서 허용할 최대 밀린 프레임 수 (최소 1)
+   */
+  std::shared_ptr<Consumer> subscribe(std::string name, DropPolicy policy, std::size_t depth = 1);
+
+  // 소비자 등록 해제 (kBlock 소비자가 더 이상 생산자를 막지 않음)
+  void unsubscribe(const std::shared_ptr<Consumer>& consumer);
+
+  /**
+   * 프레임 발행 (생산자 스레드에서만 호출)
+   * - 가장 오래된 슬롯의 프레임을 덮어씀
+   * - kBlock 소비자가 해당 슬롯을 아직 읽지 않았다면 읽을 때까지 기다림
+   */
+  void publish(const cv::Mat& frame);
+
+  // 링을 닫고 대기 중인 소비자와 생산자를 깨움
+  void close();
+
+  std::size_t capacity() const { return slots_.size(); }
+  bool closed() const { return closed_.load(std::memory_order_acquire); }
+  std::uint64_t published() const { return head_.load(std::memory_order_acquire); }
+
+ private:
+  struct Slot {
+    std::atomic<std::uint64_t> seq{0};  // 저장된 프레임의 시퀀스 번호 (0: 비어 있거나 쓰는 중)
+    std::atomic<int> readers{0};        // 프레임 헤더를 복사 중인 소비자 수
+    cv::Mat frame;
+    std::int64_t publish_ns = 0;        // 발행 시각 (steady_clock)
+  };
+
+  // 슬롯의 프레임을 복사, 그 사이 덮어쓰였으면 false
+  bool copy_slot(std::uint64_t seq, cv::Mat* frame, std::int64_t* publish_ns);
+
+  // kBlock 소비자가 seq 번 슬롯을 비울 때까지 대기
+  void wait_for_blocking_consumers(std::uint64_t seq);
+
+  // 소비자가 새 프레임을 기다림
+  bool wait_for_frame(std::uint64_t seq, std::chrono::milliseconds timeout);
+
+  // kBlock 소비자가 프레임을 읽었음을 생산자에게 알림
+  void notify_consumed();
+
+  std::vector<Slot> slots_;
+  std::atomic<std::uint64_t> head_{0}; // 마지막으로 발행된 시퀀스 번호 (1부터 시작)
+  std::atomic_bool closed_{false};
+
+  std::mutex consumers_mutex_; // 소비자 목록 보호
+  std::vector<std::shared_ptr<Consumer>> consumers_;
+  std::atomic_int blocking_consumers_{0}; // 등록된 kBlock 소비자 수
+
+  std::mutex wait_mutex_;                  // 조건 변수 대기용
+  std::condition_variable frame_cv_;       // 새 프레임 알림
+  std::condition_variable space_cv_;       // kBlock 소비자 진행 알림
+  std::atomic_int frame_waiters_{0};       // 새 프레임을 기다리는 소비자 수
+};
+
+/**
+ * FrameConsumerThread 클래스:
+ * - FrameRing 소비자 하나를 별도의 스레드에서 실행하며 프레임마다 콜백을 호출
+ * - 소멸 시 스레드를 종료하고 소비자 등록을 해제
+ */
+class FrameConsumerThread {
+ public:
+  using callback_type = std::function<void(const cv::Mat&)>;
+
+  FrameConsumerThread(FrameRing& ring, std::string name, FrameRing::DropPolicy policy,
+                      callback_type callback, std::size_t depth = 1);
+  ~FrameConsumerThread();
+
+  FrameConsumerThread(const FrameConsumerThread&) = delete;
+  FrameConsumerThread& operator=(const FrameConsumerThread&) = delete;
+
+  void join(); // 스레드 종료 대기
+
+  FrameRing::ConsumerStats stats() const { return consumer_->stats(); }
+
+ private:
+  void run_impl(); // 내부 스레드 실행 로직
+
+  FrameRing& ring_;
+  std::shared_ptr<FrameRing::Consumer> consumer_;
+  callback_type callback_;
+  std::atomic_bool stop_{false};
+  std::thread thread_;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_RING_H_
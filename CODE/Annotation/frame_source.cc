@@ -0,0 +1,157 @@
+#include "frame_source.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace sample {
+
+// **CameraFrameSource 클래스**
+bool CameraFrameSource::open() {
+  return video_.open(camera_index_);
+}
+
+void CameraFrameSource::close() {
+  video_.release();
+}
+
+// 버퍼 타임스탬프(CAP_PROP_POS_MSEC)가 지금으로부터 1초 안일 때만 steady_clock 기준으로 보고 사용
+// (백엔드에 따라 0이나 스트림 시작 기준 시간이 나오므로)
+bool CameraFrameSource::read(cv::Mat& frame) {
+  capture_ns_ = 0;
+  if (!video_.read(frame) || frame.empty())
+    return false;
+
+  const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  const auto device_ns = static_cast<std::int64_t>(video_.get(cv::CAP_PROP_POS_MSEC) * 1e6);
+  if (device_ns > 0 && device_ns <= now && now - device_ns < std::int64_t{1000000000})
+    capture_ns_ = device_ns;
+  return true;
+}
+
+bool CameraFrameSource::capture_timestamp(std::int64_t* capture_ns) const {
+  if (capture_ns_ == 0)
+    return false;
+  *capture_ns = capture_ns_;
+  return true;
+}
+
+bool CameraFrameSource::skip() {
+  return video_.grab();
+}
+
+std::string CameraFrameSource::name() const {
+  return "camera " + std::to_string(camera_index_);
+}
+
+// **VideoFileFrameSource 클래스**
+bool VideoFileFrameSource::open() {
+  ended_ = false;
+  if (!video_.open(path_))
+    return false;
+
+  const double fps = video_.get(cv::CAP_PROP_FPS);
+  interval_ = fps > 0 ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(1.0 / fps))
+                      : std::chrono::steady_clock::duration::zero();
+  next_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+void VideoFileFrameSource::close() {
+  video_.release();
+}
+
+bool VideoFileFrameSource::read(cv::Mat& frame) {
+  pace();
+  if (video_.read(frame) && !frame.empty())
+    return true;
+  if (!loop_) {
+    ended_ = true;
+    return false;
+  }
+
+  video_.set(cv::CAP_PROP_POS_FRAMES, 0); // 파일 끝: 처음으로 돌아감
+  return video_.read(frame) && !frame.empty();
+}
+
+bool VideoFileFrameSource::skip() {
+  pace();
+  if (video_.grab())
+    return true;
+  if (!loop_) {
+    ended_ = true;
+    return false;
+  }
+
+  video_.set(cv::CAP_PROP_POS_FRAMES, 0);
+  return video_.grab();
+}
+
+void VideoFileFrameSource::pace() {
+  if (!realtime_ || interval_ == std::chrono::steady_clock::duration::zero())
+    return;
+
+  // 밀렸으면 따라잡으려 하지 않고 현재 시각부터 다시 맞춤
+  const auto now = std::chrono::steady_clock::now();
+  if (next_ < now)
+    next_ = now;
+  else
+    std::this_thread::sleep_until(next_);
+  next_ += interval_;
+}
+
+// **SyntheticFrameSource 클래스**
+bool SyntheticFrameSource::open() {
+  if (size_.empty())
+    return false;
+
+  interval_ = fps_ > 0 ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                             std::chrono::duration<double>(1.0 / fps_))
+                       : std::chrono::steady_clock::duration::zero();
+  next_ = std::chrono::steady_clock::now();
+  count_ = 0;
+  return true;
+}
+
+bool SyntheticFrameSource::read(cv::Mat& frame) {
+  pace();
+
+  frame.create(size_, CV_8UC3); // 크기와 타입이 같으면 재할당 없음
+  const auto t = static_cast<int>(count_ % 256);
+  frame.setTo(cv::Scalar(t, 64, 255 - t));
+
+  // 프레임마다 한 칸씩 움직이는 사각형 (프레임 순서를 눈으로 확인할 수 있도록)
+  const int box = std::max(8, size_.height / 8);
+  const int x = static_cast<int>(count_ % static_cast<std::uint64_t>(std::max(1, size_.width - box)));
+  cv::rectangle(frame, cv::Rect(x, (size_.height - box) / 2, box, box), cv::Scalar(255, 255, 255), cv::FILLED);
+
+  ++count_;
+  return true;
+}
+
+bool SyntheticFrameSource::skip() {
+  pace();
+  ++count_;
+  return true;
+}
+
+std::string SyntheticFrameSource::name() const {
+  return "synthetic " + std::to_string(size_.width) + "x" + std::to_string(size_.height) +
+         "@" + std::to_string(static_cast<int>(fps_));
+}
+
+// 시작 시각 기준으로 다음 프레임 시각을 계산하여 오차가 누적되지 않게 함
+void SyntheticFrameSource::pace() {
+  if (interval_ == std::chrono::steady_clock::duration::zero())
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (next_ < now - interval_)
+    next_ = now; // 한 프레임 이상 밀렸으면 따라잡지 않음
+  else
+    std::this_thread::sleep_until(next_);
+  next_ += interval_;
+}
+
+} // namespace sample
@@ -0,0 +1,143 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_SOURCE_H_
+#define EYEDID_CPP_SAMPLE_FRAME_SOURCE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * FrameSource 클래스:
+ * - CameraThread가 프레임을 가져오는 입력 장치의 추상 클래스
+ * - open()/close()/read()/skip()은 모두 카메라 스레드(한 스레드)에서 호출됨
+ * - read()는 다음 프레임이 준비될 때까지 대기하며, 프레임 간격(fps) 조절도 각 구현이 담당
+ */
+class FrameSource {
+ public:
+  virtual ~FrameSource() = default;
+
+  virtual bool open() = 0;  // 입력 장치 열기
+  virtual void close() = 0; // 입력 장치 닫기
+
+  /**
+   * 다음 프레임 읽기
+   * @param frame 프레임을 저장할 버퍼 (크기와 타입이 같으면 재할당 없이 덮어씀)
+   *              외부 메모리를 가리키는 cv::Mat으로 교체하려면 그 메모리를 cv::Mat 참조 카운트로 관리해야 함
+   *              (FramePool이 참조 카운트로 버퍼 재사용을 판단, 예: SharedMemoryFrameSource)
+   * @return 프레임을 읽었으면 true (false면 end_of_stream()이 아닌 한 CameraThread가 잠시 뒤 다시 시도)
+   */
+  virtual bool read(cv::Mat& frame) = 0;
+
+  // 더 읽을 프레임이 없음 (반복하지 않는 동영상 파일의 끝, 다시 open()하기 전까지 read()가 계속 실패)
+  virtual bool end_of_stream() const { return false; }
+
+  // 프레임 하나를 버림 (FramePool의 버퍼가 모두 사용 중일 때 호출)
+  virtual bool skip() {
+    return read(scratch_);
+  }
+
+  virtual std::string name() const = 0; // 로그 출력용 이름
+
+  /**
+   * 마지막으로 read()한 프레임의 장치 타임스탬프
+   * @param capture_ns 캡처 시각 (steady_clock 기준 ns)
+   * @return 장치가 타임스탬프를 주지 않으면 false (CameraThread가 read() 직후 시각을 사용)
+   */
+  virtual bool capture_timestamp(std::int64_t* capture_ns) const { return false; }
+
+ protected:
+  cv::Mat scratch_; // skip()용 버퍼
+};
+
+/**
+ * CameraFrameSource 클래스:
+ * - cv::VideoCapture로 카메라를 인덱스로 열어 읽음 (기존 CameraThread 동작)
+ * - 백엔드가 버퍼 타임스탬프를 주면(Linux V4L2: CLOCK_MONOTONIC = steady_clock) 캡처 시각으로 사용
+ */
+class CameraFrameSource : public FrameSource {
+ public:
+  explicit CameraFrameSource(int camera_index = 0) : camera_index_(camera_index) {}
+
+  bool open() override;
+  void close() override;
+  bool read(cv::Mat& frame) override;
+  bool skip() override; // 디코딩 없이 버림
+
+  std::string name() const override;
+  bool capture_timestamp(std::int64_t* capture_ns) const override;
+
+  int camera_index() const { return camera_index_; }
+
+ private:
+  int camera_index_;
+  cv::VideoCapture video_;
+  std::int64_t capture_ns_ = 0; // 마지막 프레임의 장치 타임스탬프 (없으면 0)
+};
+
+/**
+ * VideoFileFrameSource 클래스:
+ * - 동영상 파일을 프레임 소스로 사용
+ * - realtime이면 파일의 fps에 맞춰 읽고, 아니면 디코딩되는 대로 최대한 빠르게 읽음
+ * - loop이면 파일 끝에서 처음으로 돌아감
+ */
+class VideoFileFrameSource : public FrameSource {
+ public:
+  explicit VideoFileFrameSource(std::string path, bool loop = true, bool realtime = true)
+  : path_(std::move(path)), loop_(loop), realtime_(realtime) {}
+
+  bool open() override;
+  void close() override;
+  bool read(cv::Mat& frame) override;
+  bool skip() override;
+  bool end_of_stream() const override { return ended_; }
+
+  std::string name() const override { return "video file " + path_; }
+
+ private:
+  void pace(); // realtime일 때 다음 프레임 시각까지 대기
+
+  std::string path_;
+  bool loop_;
+  bool realtime_;
+  bool ended_ = false; // loop가 아닐 때 파일 끝에 도달
+  cv::VideoCapture video_;
+  std::chrono::steady_clock::duration interval_{};
+  std::chrono::steady_clock::time_point next_;
+};
+
+/**
+ * SyntheticFrameSource 클래스:
+ * - 카메라 없이 지정한 해상도와 fps로 프레임을 생성 (헤드리스 환경의 부하/성능 시험용)
+ * - 배경색이 바뀌고 사각형이 움직이는 BGR 프레임을 버퍼에 직접 그리므로 프레임마다 할당이 없음
+ * - fps가 0 이하이면 기다리지 않고 최대한 빠르게 생성
+ */
+class SyntheticFrameSource : public FrameSource {
+ public:
+  SyntheticFrameSource(cv::Size size = {640, 480}, double fps = 30.0)
+  : size_(size), fps_(fps) {}
+
+  bool open() override;
+  void close() override {}
+  bool read(cv::Mat& frame) override;
+  bool skip() override; // 그리지 않고 시간만 진행
+
+  std::string name() const override;
+
+  std::uint64_t generated() const { return count_; } // 생성한(건너뛴 것 포함) 프레임 수
+
+ private:
+  void pace();
+
+  cv::Size size_;
+  double fps_;
+  std::uint64_t count_ = 0;
+  std::chrono::steady_clock::duration interval_{};
+  std::chrono::steady_clock::time_point next_;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_SOURCE_H_
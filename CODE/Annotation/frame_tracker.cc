@@ -0,0 +1,65 @@
+#include "frame_tracker.h"
+
+#include <cmath>
+
+namespace sample {
+
+StubGazeTracker::StubGazeTracker()
+: StubGazeTracker(Options()) {}
+
+StubGazeTracker::StubGazeTracker(const Options& options)
+: options_(options) {}
+
+// 1. 프레임을 성기게 훑어 읽고 (16픽셀 간격)
+// 2. 남은 시간은 바쁜 대기로 채워 프레임당 비용을 일정하게 맞춘 뒤
+// 3. 합성한 결과를 콜백으로 전달
+bool StubGazeTracker::addFrame(std::int64_t timestamp, const std::uint8_t* rgb, int width, int height) {
+  const auto begin = std::chrono::steady_clock::now();
+  if (rgb == nullptr || width <= 0 || height <= 0)
+    return false;
+
+  std::uint32_t sum = 0;
+  const auto stride = static_cast<std::size_t>(width) * 3;
+  for (int y = 0; y < height; y += 16) {
+    const std::uint8_t* row = rgb + stride * y;
+    for (std::size_t x = 0; x < stride; x += 48)
+      sum += row[x];
+  }
+  checksum_ += sum;
+
+  const auto deadline = begin + options_.work;
+  while (std::chrono::steady_clock::now() < deadline) {}
+
+  frames_.fetch_add(1, std::memory_order_relaxed);
+  if (callback_ == nullptr)
+    return true;
+
+  const float t = static_cast<float>(timestamp) * 1e-3f;
+  EyedidGazeData gaze = {};
+  gaze.x = options_.screen.width * (0.5f + 0.4f * std::sin(t * 0.9f));
+  gaze.y = options_.screen.height * (0.5f + 0.4f * std::sin(t * 1.3f));
+  gaze.fixation_x = gaze.x;
+  gaze.fixation_y = gaze.y;
+  gaze.tracking_state = kEyedidTrackingSuccess;
+  gaze.movement_state = kEyedidEyeMovementFixation;
+
+  EyedidFaceData face = {};
+  face.score = 1.f;
+  face.left = 0.3f;
+  face.top = 0.2f;
+  face.right = 0.7f;
+  face.bottom = 0.8f;
+  face.center_z = 600.f;
+
+  EyedidBlinkData blink = {};
+  blink.left_openness = 1.f;
+  blink.right_openness = 1.f;
+
+  EyedidUserStatusData user_status = {};
+  user_status.attention_score = 1.f;
+
+  callback_->OnMetrics(static_cast<std::uint64_t>(timestamp), gaze, face, blink, user_status);
+  return true;
+}
+
+} // namespace sample
@@ -0,0 +1,70 @@
+#ifndef EYEDID_CPP_SAMPLE_FRAME_TRACKER_H_
+#define EYEDID_CPP_SAMPLE_FRAME_TRACKER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "eyedid/gaze_tracker.h"
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * FrameTracker 클래스:
+ * - TrackerManager가 프레임을 넘기는 추적기의 추상 클래스 (eyedid::GazeTracker의 프레임 입력과 캘리브레이션 부분)
+ * - SDK는 EyedidFrameTracker, 시험/측정용은 StubGazeTracker (TrackerManager::initialize(std::unique_ptr<FrameTracker>))
+ * - 결과는 setTrackingCallback()으로 받은 콜백의 OnMetrics()로 전달
+ */
+class FrameTracker {
+ public:
+  virtual ~FrameTracker() = default;
+
+  virtual void setTrackingCallback(eyedid::ITrackingCallback* callback) = 0;
+
+  /**
+   * 프레임 추가 (RGB)
+   * @param timestamp 프레임 타임스탬프 (ms, 프레임마다 증가)
+   * @return 프레임을 받았으면 true
+   */
+  virtual bool addFrame(std::int64_t timestamp, const std::uint8_t* rgb, int width, int height) = 0;
+
+  // 캘리브레이션 (지원하지 않는 추적기는 무시)
+  virtual void setCalibrationCallback(eyedid::ICalibrationCallback* callback) {}
+  virtual void startCollectSamples() {}
+};
+
+/**
+ * StubGazeTracker 클래스:
+ * - 라이선스와 SDK 추적기(GazeTracker) 없이 세션 처리량(코어당 세션 수)을 측정하기 위한 추적기
+ *   (eyedid_frame_tracker.cc를 빼고 빌드하면 GazeTracker를 만들거나 참조하지 않음)
+ * - addFrame()을 호출한 스레드에서 프레임을 읽고 work만큼 CPU를 사용한 뒤, 바로 OnMetrics()를 호출
+ *   (SDK는 내부 스레드에서 추적하지만, 여기서는 추적 비용이 호출한 스레드의 코어에 드러나도록 동기적으로 처리)
+ * - 시선은 타임스탬프에 따라 screen 안을 도는 좌표, 얼굴과 사용자 상태는 고정값
+ * - 한 번에 한 스레드에서만 addFrame()을 호출해야 함
+ */
+class StubGazeTracker : public FrameTracker {
+ public:
+  struct Options {
+    std::chrono::microseconds work{3000}; // 프레임당 추적 비용 (바쁜 대기)
+    cv::Size screen{1920, 1080};          // 시선 좌표 범위
+  };
+
+  StubGazeTracker();
+  explicit StubGazeTracker(const Options& options);
+
+  void setTrackingCallback(eyedid::ITrackingCallback* callback) override { callback_ = callback; }
+  bool addFrame(std::int64_t timestamp, const std::uint8_t* rgb, int width, int height) override;
+
+  std::uint64_t frames() const { return frames_.load(std::memory_order_relaxed); } // 처리한 프레임 수
+
+ private:
+  const Options options_;
+  eyedid::ITrackingCallback* callback_ = nullptr;
+  std::uint32_t checksum_ = 0; // 프레임을 실제로 읽도록 남겨 두는 값
+  std::atomic<std::uint64_t> frames_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_FRAME_TRACKER_H_
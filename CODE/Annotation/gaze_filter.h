@@ -0,0 +1,285 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_FILTER_H_
+#define EYEDID_CPP_SAMPLE_GAZE_FILTER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * 시선 좌표 필터
+ * - 모든 필터는 filter(timestamp, point) 형태로 호출하며, 메모리를 할당하지 않음
+ * - timestamp는 SDK 타임스탬프 (ms), 간격이 kGazeFilterResetGapMs보다 길거나 시간이 되돌아가면 처음부터 다시 시작
+ * - 한 스레드에서만 사용해야 함
+ * - TrackerManager에는 GazeFilterStage<필터>로 감싸서 연결 (make_gaze_filter)
+ */
+constexpr std::uint64_t kGazeFilterResetGapMs = 250;
+
+namespace detail {
+
+constexpr float kPi = 3.14159265358979f;
+
+// 차단 주파수(Hz)와 시간 간격(s)에 대한 1차 저역 통과 계수
+inline float low_pass_alpha(float cutoff, float dt) {
+  const float tau = 1.f / (2.f * kPi * cutoff);
+  return 1.f / (1.f + tau / dt);
+}
+
+// 직전 시각으로부터의 간격 (s), 다시 시작해야 하면 0
+inline float elapsed_seconds(bool initialized, std::uint64_t last, std::uint64_t now) {
+  if (!initialized || now <= last || now - last > kGazeFilterResetGapMs)
+    return 0.f;
+  return static_cast<float>(now - last) * 1e-3f;
+}
+
+} // namespace detail
+
+// 필터 없음 (원본 좌표 그대로)
+struct PassThroughFilter {
+  void reset() {}
+  cv::Point2f operator()(std::uint64_t, const cv::Point2f& p) { return p; }
+};
+
+/**
+ * One Euro 필터 (Casiez et al., CHI 2012)
+ * - 느리게 움직일 때는 강하게 평활화하여 떨림을 없애고, 빠르게 움직일 때는 차단 주파수를 올려 지연을 줄임
+ * - 차단 주파수 = min_cutoff + beta * |속도|
+ */
+struct OneEuroFilter {
+  float min_cutoff = 1.0f;  // 최소 차단 주파수 (Hz, 작을수록 떨림이 줄고 지연이 늘어남)
+  float beta = 0.007f;      // 속도 계수 (클수록 빠른 움직임을 덜 지연시킴)
+  float d_cutoff = 1.0f;    // 속도 평활화 차단 주파수 (Hz)
+
+  void reset() { initialized_ = false; }
+
+  cv::Point2f operator()(std::uint64_t timestamp, const cv::Point2f& p) {
+    const float dt = detail::elapsed_seconds(initialized_, last_, timestamp);
+    last_ = timestamp;
+    if (dt <= 0.f) {
+      initialized_ = true;
+      value_ = p;
+      velocity_ = cv::Point2f(0.f, 0.f);
+      return p;
+    }
+
+    const float ad = detail::low_pass_alpha(d_cutoff, dt);
+    velocity_.x += ad * ((p.x - value_.x) / dt - velocity_.x);
+    velocity_.y += ad * ((p.y - value_.y) / dt - velocity_.y);
+
+    const float speed = std::sqrt(velocity_.x * velocity_.x + velocity_.y * velocity_.y);
+    const float a = detail::low_pass_alpha(min_cutoff + beta * speed, dt);
+    value_.x += a * (p.x - value_.x);
+    value_.y += a * (p.y - value_.y);
+    return value_;
+  }
+
+  // 평활화된 속도 (px/s)
+  cv::Point2f velocity() const { return velocity_; }
+
+ private:
+  bool initialized_ = false;
+  std::uint64_t last_ = 0;
+  cv::Point2f value_;
+  cv::Point2f velocity_;
+};
+
+/**
+ * 칼만 필터 (등속 모델, x/y 축 독립)
+ * - 상태: 위치와 속도, 가속도를 백색 잡음으로 보고 측정 잡음과의 비율로 평활화 정도를 정함
+ * - lead_ms만큼 앞의 위치를 추정된 속도로 예측하여 반환 (0이면 현재 위치)
+ */
+struct KalmanFilter {
+  float acceleration_sigma = 30000.f; // 가속도 잡음 (px/s^2, 클수록 빠른 움직임을 따라감)
+  float measurement_sigma = 30.f;     // 측정 잡음 (px, 클수록 강하게 평활화)
+  float lead_ms = 0.f;                // 예측 시간 (ms)
+
+  void reset() { initialized_ = false; }
+
+  cv::Point2f operator()(std::uint64_t timestamp, const cv::Point2f& p) {
+    const float dt = detail::elapsed_seconds(initialized_, last_, timestamp);
+    last_ = timestamp;
+    if (dt <= 0.f) {
+      initialized_ = true;
+      const float r = measurement_sigma * measurement_sigma;
+      x_.init(p.x, r);
+      y_.init(p.y, r);
+      return p;
+    }
+
+    const float q = acceleration_sigma * acceleration_sigma;
+    const float r = measurement_sigma * measurement_sigma;
+    x_.step(p.x, dt, q, r);
+    y_.step(p.y, dt, q, r);
+
+    const float lead = lead_ms * 1e-3f;
+    return cv::Point2f(x_.p + x_.v * lead, y_.p + y_.v * lead);
+  }
+
+  // 추정된 속도 (px/s)
+  cv::Point2f velocity() const { return cv::Point2f(x_.v, y_.v); }
+
+ private:
+  // 한 축의 상태 (위치, 속도)와 공분산
+  struct Axis {
+    float p = 0.f, v = 0.f;
+    float pp = 0.f, pv = 0.f, vv = 0.f;
+
+    void init(float z, float r) {
+      p = z;
+      v = 0.f;
+      pp = r;
+      pv = 0.f;
+      vv = 1e6f; // 초기 속도는 모름
+    }
+
+    void step(float z, float dt, float q, float r) {
+      // 예측: x = F x, P = F P F' + Q (Q: 가속도 백색 잡음)
+      const float dt2 = dt * dt;
+      p += v * dt;
+      pp += dt * (2.f * pv + dt * vv) + q * dt2 * dt2 * 0.25f;
+      pv += dt * vv + q * dt2 * dt * 0.5f;
+      vv += q * dt2;
+
+      // 갱신: 위치만 측정
+      const float s = pp + r;
+      const float kp = pp / s;
+      const float kv = pv / s;
+      const float e = z - p;
+      p += kp * e;
+      v += kv * e;
+      vv -= kv * pv;
+      pv -= kv * pp;
+      pp -= kp * pp;
+    }
+  };
+
+  bool initialized_ = false;
+  std::uint64_t last_ = 0;
+  Axis x_;
+  Axis y_;
+};
+
+/**
+ * 등속 예측 필터
+ * - Smoother로 평활화한 위치에서 속도를 구해, 화면에 표시될 시각의 위치로 외삽
+ * - 예측 시간은 시선마다 계산: (지금 - 캡처 시각) + present_delay_ms
+ *   - timestamp는 steady_clock 캡처 시각 (ms, TrackerManager::addFrame(FrameEnvelope))
+ *   - present_delay_ms는 지금부터 화면에 표시될 때까지의 예상 지연 (FrameClock::present_delay())
+ *   - 기록 재생처럼 timestamp가 현재 시각과 무관하면 live = false (예측 시간 = present_delay_ms)
+ * - 고정(fixation) 중에는 속도가 0에 가까우므로 평활화 결과와 같음
+ * - 도약(saccade)은 수십 ms 안에 끝나 예측할 수 없으므로, 속도가 saccade_speed를 넘으면 외삽하지 않고
+ *   속도를 버림 (도약 뒤 고정에서 남은 속도로 지나쳐 가지 않도록)
+ *
+ * @tparam Smoother 위치 평활화 필터 (예: OneEuroFilter)
+ */
+template<typename Smoother = OneEuroFilter>
+struct ConstantVelocityPredictor {
+  Smoother smoother;             // 위치 평활화 필터
+  float present_delay_ms = 15.f; // 지금부터 화면에 표시될 때까지의 예상 지연 (ms)
+  bool live = true;              // 캡처부터 지금까지 지난 시간을 예측 시간에 더함
+  float max_lead_ms = 200.f;     // 예측 시간 상한 (ms, 시각이 어긋나도 멀리 외삽하지 않도록)
+  float velocity_cutoff = 2.f;   // 속도 평활화 차단 주파수 (Hz)
+  float saccade_speed = 1500.f;  // 이 속도(px/s)를 넘으면 도약으로 보고 외삽하지 않음
+
+  void reset() {
+    smoother.reset();
+    initialized_ = false;
+  }
+
+  cv::Point2f operator()(std::uint64_t timestamp, const cv::Point2f& p) {
+    const cv::Point2f s = smoother(timestamp, p);
+    const float dt = detail::elapsed_seconds(initialized_, last_, timestamp);
+    last_ = timestamp;
+    if (dt <= 0.f) {
+      initialized_ = true;
+      previous_ = s;
+      velocity_ = cv::Point2f(0.f, 0.f);
+      return s;
+    }
+
+    const cv::Point2f v((s.x - previous_.x) / dt, (s.y - previous_.y) / dt);
+    previous_ = s;
+    if (v.x * v.x + v.y * v.y > saccade_speed * saccade_speed) {
+      velocity_ = cv::Point2f(0.f, 0.f);
+      return s;
+    }
+
+    const float a = detail::low_pass_alpha(velocity_cutoff, dt);
+    velocity_.x += a * (v.x - velocity_.x);
+    velocity_.y += a * (v.y - velocity_.y);
+
+    last_lead_ms_ = lead_for(timestamp);
+    const float lead = last_lead_ms_ * 1e-3f;
+    return cv::Point2f(s.x + velocity_.x * lead, s.y + velocity_.y * lead);
+  }
+
+  // 마지막으로 외삽한 예측 시간 (ms)
+  float last_lead_ms() const { return last_lead_ms_; }
+
+ private:
+  // 캡처 시각이 timestamp(ms)인 시선의 예측 시간 (ms)
+  float lead_for(std::uint64_t timestamp) const {
+    float lead = present_delay_ms;
+    if (live) {
+      using namespace std::chrono;
+      const auto now_us = duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+      const auto age_us = now_us - static_cast<std::int64_t>(timestamp) * 1000;
+      if (age_us > 0)
+        lead += static_cast<float>(age_us) * 1e-3f;
+    }
+    return std::min(lead, max_lead_ms);
+  }
+
+  bool initialized_ = false;
+  std::uint64_t last_ = 0;
+  cv::Point2f previous_;
+  cv::Point2f velocity_;
+  float last_lead_ms_ = 0.f;
+};
+
+/**
+ * GazeFilter 클래스:
+ * - TrackerManager에 연결하는 필터 단계의 공통 인터페이스
+ * - 시선마다 가상 함수 호출은 한 번이며, 필터 계산은 GazeFilterStage 안에서 인라인됨
+ */
+class GazeFilter {
+ public:
+  virtual ~GazeFilter() = default;
+  virtual void reset() = 0;
+  virtual cv::Point2f apply(std::uint64_t timestamp, const cv::Point2f& p) = 0;
+};
+
+/**
+ * GazeFilterStage 클래스:
+ * - 필터 타입 F를 GazeFilter로 감쌈
+ * @tparam F 필터 타입 (reset(), operator()(timestamp, point))
+ */
+template<typename F>
+class GazeFilterStage final : public GazeFilter {
+ public:
+  explicit GazeFilterStage(F filter = F()) : filter_(std::move(filter)) {}
+
+  void reset() override { filter_.reset(); }
+  cv::Point2f apply(std::uint64_t timestamp, const cv::Point2f& p) override { return filter_(timestamp, p); }
+
+  F& filter() { return filter_; }
+
+ private:
+  F filter_;
+};
+
+// 필터를 GazeFilterStage로 감싸 TrackerManager::setGazeFilter()에 넘길 수 있게 함
+template<typename F>
+std::unique_ptr<GazeFilter> make_gaze_filter(F filter) {
+  return std::unique_ptr<GazeFilter>(new GazeFilterStage<F>(std::move(filter)));
+}
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_FILTER_H_
@@ -0,0 +1,377 @@
+#include "gaze_heatmap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#  define EYEDID_SAMPLE_SIMD_AVX2 1
+#elif defined(__SSE4_1__)
+#  include <smmintrin.h>
+#  define EYEDID_SAMPLE_SIMD_SSE41 1
+#endif
+
+namespace sample {
+
+namespace {
+
+constexpr float kMaxWeightExponent = 20.f; // 가중치가 2^20을 넘으면 격자를 정규화
+constexpr float kForgetExponent = 64.f;    // 이만큼 반감기가 지나면 이전 히트맵은 0으로 봄
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2) || defined(EYEDID_SAMPLE_SIMD_SSE41)
+inline float horizontal_max(__m128 v) {
+  v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+  v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 1));
+  return _mm_cvtss_f32(v);
+}
+#endif
+
+// dst[i] += src[i] * w (타일 한 행, 최대 16칸), 더한 뒤의 최댓값 반환
+float add_scaled(float* dst, const float* src, float w, int n) {
+  int i = 0;
+  float result = 0.f;
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2)
+  const __m256 wv = _mm256_set1_ps(w);
+  __m256 mx = _mm256_setzero_ps();
+  for (; i + 8 <= n; i += 8) {
+    const __m256 d = _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), wv));
+    _mm256_storeu_ps(dst + i, d);
+    mx = _mm256_max_ps(mx, d);
+  }
+  result = horizontal_max(_mm_max_ps(_mm256_castps256_ps128(mx), _mm256_extractf128_ps(mx, 1)));
+#elif defined(EYEDID_SAMPLE_SIMD_SSE41)
+  const __m128 wv = _mm_set1_ps(w);
+  __m128 mx = _mm_setzero_ps();
+  for (; i + 4 <= n; i += 4) {
+    const __m128 d = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), wv));
+    _mm_storeu_ps(dst + i, d);
+    mx = _mm_max_ps(mx, d);
+  }
+  result = horizontal_max(mx);
+#endif
+
+  for (; i < n; ++i) {
+    dst[i] += src[i] * w;
+    result = std::max(result, dst[i]);
+  }
+  return result;
+}
+
+// data[i] *= factor
+void scale(float* data, float factor, std::size_t n) {
+  std::size_t i = 0;
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2)
+  const __m256 fv = _mm256_set1_ps(factor);
+  for (; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), fv));
+#elif defined(EYEDID_SAMPLE_SIMD_SSE41)
+  const __m128 fv = _mm_set1_ps(factor);
+  for (; i + 4 <= n; i += 4)
+    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), fv));
+#endif
+
+  for (; i < n; ++i)
+    data[i] *= factor;
+}
+
+// dst[i] = min(src[i] * factor, 255) (타일 한 행, 최대 16칸)
+void quantize(const float* src, float factor, std::uint8_t* dst, int n) {
+  int i = 0;
+
+#if defined(EYEDID_SAMPLE_SIMD_AVX2) || defined(EYEDID_SAMPLE_SIMD_SSE41)
+  const __m128 fv = _mm_set1_ps(factor);
+  if (n == 16) { // 정수로 바꾼 뒤 포화 변환으로 16바이트에 모음
+    const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src), fv));
+    const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 4), fv));
+    const __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 8), fv));
+    const __m128i d = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 12), fv));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    i = 16;
+  }
+#endif
+
+  for (; i < n; ++i)
+    dst[i] = static_cast<std::uint8_t>(std::min(src[i] * factor, 255.f));
+}
+
+inline float clamp01(float v) {
+  return std::min(std::max(v, 0.f), 1.f);
+}
+
+} // namespace
+
+constexpr int GazeHeatmap::kTileSize;
+
+GazeHeatmap::GazeHeatmap()
+: GazeHeatmap(Options()) {}
+
+GazeHeatmap::GazeHeatmap(const Options& options)
+: options_(options),
+  queue_(options.queue_capacity) {
+  options_.cell = std::max(options_.cell, 1);
+  options_.regions.width = std::max(options_.regions.width, 1);
+  options_.regions.height = std::max(options_.regions.height, 1);
+
+  cols_ = std::max((options_.screen.width + options_.cell - 1) / options_.cell, 1);
+  rows_ = std::max((options_.screen.height + options_.cell - 1) / options_.cell, 1);
+  tiles_x_ = (cols_ + kTileSize - 1) / kTileSize;
+  const int tiles_y = (rows_ + kTileSize - 1) / kTileSize;
+  grid_.assign(static_cast<std::size_t>(tiles_x_) * tiles_y * kTileSize * kTileSize, 0.f);
+  row_.resize(static_cast<std::size_t>(tiles_x_) * kTileSize);
+
+  // 3 sigma 밖은 무시
+  const float sigma = std::max(options_.sigma / options_.cell, 0.5f);
+  radius_ = static_cast<int>(std::ceil(sigma * 3.f));
+  inv_two_sigma2_ = 1.f / (2.f * sigma * sigma);
+  kx_.resize(2 * radius_ + 2);
+  ky_.resize(2 * radius_ + 2);
+
+  // 파랑 → 청록 → 노랑 → 빨강 (jet), 값이 작을수록 투명
+  const float opacity = clamp01(options_.opacity);
+  for (int i = 0; i < 256; ++i) {
+    const float t = i / 255.f;
+    lut_[i][0] = static_cast<std::uint8_t>(255.f * clamp01(1.5f - std::fabs(4.f * t - 1.f)));
+    lut_[i][1] = static_cast<std::uint8_t>(255.f * clamp01(1.5f - std::fabs(4.f * t - 2.f)));
+    lut_[i][2] = static_cast<std::uint8_t>(255.f * clamp01(1.5f - std::fabs(4.f * t - 3.f)));
+    lut_[i][3] = static_cast<std::uint8_t>(255.f * opacity * clamp01(t * 3.f));
+  }
+
+  const int rx = options_.regions.width;
+  const int ry = options_.regions.height;
+  regions_.resize(static_cast<std::size_t>(rx) * ry);
+  for (int j = 0; j < ry; ++j) {
+    for (int i = 0; i < rx; ++i) {
+      const int x0 = options_.screen.width * i / rx;
+      const int y0 = options_.screen.height * j / ry;
+      const int x1 = options_.screen.width * (i + 1) / rx;
+      const int y1 = options_.screen.height * (j + 1) / ry;
+      regions_[j * rx + i].rect = cv::Rect(x0, y0, x1 - x0, y1 - y0);
+    }
+  }
+}
+
+void GazeHeatmap::attach(TrackerManager& tracker_manager) {
+  connection_ = tracker_manager.on_gaze_sample_.connect([this](const GazeSample& sample) {
+    push(sample);
+  });
+}
+
+void GazeHeatmap::detach() {
+  connection_ = connection();
+}
+
+void GazeHeatmap::push(const GazeSample& sample) {
+  GazeSample copy = sample;
+  if (!queue_.try_push(std::move(copy)))
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t GazeHeatmap::update() {
+  std::size_t n = 0;
+  GazeSample sample;
+  while (queue_.try_pop(&sample)) {
+    process(sample);
+    ++n;
+  }
+  samples_.fetch_add(n, std::memory_order_relaxed);
+  return n;
+}
+
+bool GazeHeatmap::render(cv::Mat* bgra) {
+  if (!dirty_)
+    return false;
+
+  bgra->create(rows_, cols_, CV_8UC4);
+  const float factor = peak_ > 0.f ? 255.f / peak_ : 0.f;
+  for (int gy = 0; gy < rows_; ++gy) {
+    for (int tx = 0; tx < tiles_x_; ++tx) {
+      const int gx = tx * kTileSize;
+      quantize(&grid_[index(gx, gy)], factor, &row_[gx], std::min(kTileSize, cols_ - gx));
+    }
+    auto* out = bgra->ptr<std::uint8_t>(gy);
+    for (int gx = 0; gx < cols_; ++gx)
+      std::memcpy(out + gx * 4, lut_[row_[gx]], 4);
+  }
+
+  dirty_ = false;
+  renders_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void GazeHeatmap::clear() {
+  std::fill(grid_.begin(), grid_.end(), 0.f);
+  peak_ = 0.f;
+  has_time_ = false;
+  in_fixation_ = false;
+  has_last_fixation_ = false;
+  in_saccade_ = false;
+  for (auto& region : regions_) {
+    const auto rect = region.rect;
+    region = RegionStats();
+    region.rect = rect;
+  }
+  dirty_ = true;
+}
+
+float GazeHeatmap::value(int x, int y) const {
+  if (peak_ <= 0.f || x < 0 || y < 0 || x >= options_.screen.width || y >= options_.screen.height)
+    return 0.f;
+  return grid_[index(x / options_.cell, y / options_.cell)] / peak_;
+}
+
+GazeHeatmap::Stats GazeHeatmap::stats() const {
+  Stats stats;
+  stats.samples = samples_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.fixations = fixations_.load(std::memory_order_relaxed);
+  stats.saccades = saccades_.load(std::memory_order_relaxed);
+  stats.renders = renders_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 시선 하나를 히트맵과 고정/도약 상태에 반영
+// - 고정: SDK가 고정 상태로 보고하는 동안 고정 시선 좌표를 모아, 상태가 바뀔 때 중심과 시간을 집계
+// - 도약: 도약 상태로 바뀌는 순간 직전 고정 중심에서 출발한 것으로 보고, 다음 고정이 시작될 때 거리를 집계
+void GazeHeatmap::process(const GazeSample& sample) {
+  if (!sample.valid) {
+    end_fixation();
+    in_saccade_ = false; // 추적이 끊긴 도약은 거리를 알 수 없음
+    return;
+  }
+
+  splat(sample.x, sample.y, weight_at(sample.timestamp));
+  const int region = region_of(sample.x, sample.y);
+  if (region >= 0)
+    ++regions_[region].samples;
+
+  if (sample.movement_state == kEyedidEyeMovementFixation) {
+    if (!in_fixation_) {
+      if (in_saccade_ && saccade_region_ >= 0) {
+        const float dx = sample.fixation_x - saccade_origin_.x;
+        const float dy = sample.fixation_y - saccade_origin_.y;
+        regions_[saccade_region_].saccade_amplitude += std::sqrt(dx * dx + dy * dy);
+      }
+      in_saccade_ = false;
+      in_fixation_ = true;
+      fixation_start_ = sample.timestamp;
+      fixation_sum_x_ = 0;
+      fixation_sum_y_ = 0;
+      fixation_count_ = 0;
+    }
+    fixation_sum_x_ += sample.fixation_x;
+    fixation_sum_y_ += sample.fixation_y;
+    ++fixation_count_;
+    fixation_end_ = sample.timestamp;
+    return;
+  }
+
+  end_fixation();
+  if (sample.movement_state == kEyedidEyeMovementSaccade && !in_saccade_) {
+    in_saccade_ = true;
+    saccade_origin_ = has_last_fixation_ ? last_fixation_ : cv::Point2f(sample.x, sample.y);
+    saccade_region_ = region_of(saccade_origin_.x, saccade_origin_.y);
+    if (saccade_region_ >= 0)
+      ++regions_[saccade_region_].saccades;
+    saccades_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void GazeHeatmap::end_fixation() {
+  if (!in_fixation_)
+    return;
+  in_fixation_ = false;
+
+  last_fixation_ = cv::Point2f(static_cast<float>(fixation_sum_x_ / fixation_count_),
+                               static_cast<float>(fixation_sum_y_ / fixation_count_));
+  has_last_fixation_ = true;
+  const int region = region_of(last_fixation_.x, last_fixation_.y);
+  if (region >= 0) {
+    ++regions_[region].fixations;
+    regions_[region].fixation_ms += static_cast<double>(fixation_end_ - fixation_start_);
+  }
+  fixations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 가로/세로 가우시안을 따로 계산한 뒤, 타일 안에서 연속된 행 단위로 더함
+void GazeHeatmap::splat(float x, float y, float weight) {
+  const float u = x / options_.cell - 0.5f; // 칸 중심 기준 좌표
+  const float v = y / options_.cell - 0.5f;
+  const int gx0 = std::max(0, static_cast<int>(std::ceil(u - radius_)));
+  const int gx1 = std::min(cols_ - 1, static_cast<int>(std::floor(u + radius_)));
+  const int gy0 = std::max(0, static_cast<int>(std::ceil(v - radius_)));
+  const int gy1 = std::min(rows_ - 1, static_cast<int>(std::floor(v + radius_)));
+  if (gx0 > gx1 || gy0 > gy1)
+    return; // 화면 밖
+
+  for (int gx = gx0; gx <= gx1; ++gx) {
+    const float d = gx - u;
+    kx_[gx - gx0] = std::exp(-d * d * inv_two_sigma2_);
+  }
+  for (int gy = gy0; gy <= gy1; ++gy) {
+    const float d = gy - v;
+    ky_[gy - gy0] = weight * std::exp(-d * d * inv_two_sigma2_);
+  }
+
+  for (int gy = gy0; gy <= gy1; ++gy) {
+    const float wy = ky_[gy - gy0];
+    for (int gx = gx0; gx <= gx1;) {
+      const int n = std::min(gx1 + 1, (gx / kTileSize + 1) * kTileSize) - gx; // 타일 경계까지
+      peak_ = std::max(peak_, add_scaled(&grid_[index(gx, gy)], &kx_[gx - gx0], wy, n));
+      gx += n;
+    }
+  }
+  dirty_ = true;
+}
+
+// 새 시선의 가중치 = 2^((시각 - 기준 시각) / 반감기)
+// - 모든 칸에 같은 비율로 곱해지는 감쇠를 새 시선 쪽에 반영하므로 격자 전체를 매번 곱하지 않음
+// - 가중치가 너무 커지면 격자를 한 번 나누고 기준 시각을 옮김
+float GazeHeatmap::weight_at(std::uint64_t timestamp) {
+  if (options_.half_life_ms <= 0.f)
+    return 1.f;
+
+  if (!has_time_) {
+    has_time_ = true;
+    base_time_ = last_time_ = timestamp;
+    return 1.f;
+  }
+
+  if (timestamp < last_time_) {
+    // 시간이 되돌아감 (재생 반복 등): 지금까지의 히트맵을 현재 값으로 보고 기준 시각을 옮김
+    rescale(std::exp2(-static_cast<float>(last_time_ - base_time_) / options_.half_life_ms));
+    base_time_ = timestamp;
+  }
+  last_time_ = timestamp;
+
+  const float exponent = static_cast<float>(timestamp - base_time_) / options_.half_life_ms;
+  if (exponent <= kMaxWeightExponent)
+    return std::exp2(exponent);
+
+  if (exponent > kForgetExponent) {
+    std::fill(grid_.begin(), grid_.end(), 0.f);
+    peak_ = 0.f;
+  } else {
+    rescale(std::exp2(-exponent));
+  }
+  base_time_ = timestamp;
+  return 1.f;
+}
+
+void GazeHeatmap::rescale(float factor) {
+  scale(grid_.data(), factor, grid_.size());
+  peak_ *= factor;
+  dirty_ = true;
+}
+
+int GazeHeatmap::region_of(float x, float y) const {
+  if (x < 0.f || y < 0.f || x >= options_.screen.width || y >= options_.screen.height)
+    return -1;
+  const int i = static_cast<int>(x * options_.regions.width / options_.screen.width);
+  const int j = static_cast<int>(y * options_.regions.height / options_.screen.height);
+  return std::min(j, options_.regions.height - 1) * options_.regions.width + std::min(i, options_.regions.width - 1);
+}
+
+} // namespace sample
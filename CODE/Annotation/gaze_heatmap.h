@@ -0,0 +1,162 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_HEATMAP_H_
+#define EYEDID_CPP_SAMPLE_GAZE_HEATMAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+#include "mpsc_queue.h"
+#include "simple_signal.h"
+#include "tracker_manager.h"
+
+namespace sample {
+
+/**
+ * GazeHeatmap 클래스:
+ * - 시선 데이터(GazeSample)를 누적하여 시선 히트맵과 영역별 고정/도약 통계를 만듦
+ * - 히트맵: cell 픽셀 단위 격자에 시선 위치마다 가우시안을 더함 (splatting)
+ *   - 격자는 16x16 칸 타일 단위로 저장하여 가우시안을 더할 때 접근하는 메모리가 모여 있음
+ *   - 오래된 시선은 반감기(half_life_ms)에 따라 지수적으로 약해짐
+ *     (격자 전체를 매번 곱하지 않고, 새 시선의 가중치를 키운 뒤 가끔 한 번에 정규화)
+ * - 고정/도약 통계: SDK의 눈 움직임 상태로 고정(fixation) 구간과 도약(saccade)을 나누어
+ *   화면을 regions 크기로 나눈 영역별로 집계
+ * - push()는 어느 스레드에서나 호출 가능 (잠금 없는 큐에 넣기만 함, 1kHz 이상 입력 가능)
+ * - update()/render()/region_stats()/clear()는 한 스레드(GUI 스레드)에서만 호출해야 함
+ */
+class GazeHeatmap {
+ public:
+  struct Options {
+    cv::Size screen = {1280, 720};      // 시선 좌표 범위 (창 크기)
+    int cell = 4;                       // 격자 한 칸의 크기 (픽셀)
+    float sigma = 24.f;                 // 가우시안 표준편차 (픽셀)
+    float half_life_ms = 3000.f;        // 반감기 (ms, 0 이하이면 약해지지 않음)
+    cv::Size regions = {4, 3};          // 통계를 집계할 영역 수 (가로, 세로)
+    float opacity = 0.6f;               // render() 결과의 최대 불투명도 (0 ~ 1)
+    std::size_t queue_capacity = 4096;  // push()와 update() 사이에 쌓아 둘 수 있는 시선 수
+  };
+
+  // 영역별 고정/도약 통계
+  struct RegionStats {
+    cv::Rect rect;                      // 영역 (픽셀)
+    std::uint64_t samples = 0;          // 영역 안의 유효한 시선 수
+    std::uint64_t fixations = 0;        // 영역 안에서 끝난 고정 수 (고정 중심 기준)
+    double fixation_ms = 0;             // 고정 시간 합계 (ms)
+    std::uint64_t saccades = 0;         // 영역에서 출발한 도약 수
+    double saccade_amplitude = 0;       // 출발한 도약의 이동 거리 합계 (픽셀)
+  };
+
+  // 처리 통계 (어느 스레드에서나 호출 가능)
+  struct Stats {
+    std::uint64_t samples = 0;          // 처리한 시선 수
+    std::uint64_t dropped = 0;          // 큐가 가득 차서 버린 시선 수
+    std::uint64_t fixations = 0;        // 끝난 고정 수
+    std::uint64_t saccades = 0;         // 시작된 도약 수
+    std::uint64_t renders = 0;          // render() 수
+  };
+
+  static constexpr int kTileSize = 16;  // 타일 한 변의 칸 수
+
+  GazeHeatmap();
+  explicit GazeHeatmap(const Options& options);
+
+  GazeHeatmap(const GazeHeatmap&) = delete;
+  GazeHeatmap& operator=(const GazeHeatmap&) = delete;
+
+  /**
+   * TrackerManager::on_gaze_sample_을 받아 누적
+   * - 연결은 이 객체가 소멸하거나 detach()할 때 끊어짐
+   */
+  void attach(TrackerManager& tracker_manager);
+  void detach();
+
+  // 시선 추가 (어느 스레드에서나 호출 가능, 대기 없음)
+  void push(const GazeSample& sample);
+
+  /**
+   * push()된 시선을 히트맵과 통계에 반영
+   * @return 반영한 시선 수
+   */
+  std::size_t update();
+
+  /**
+   * 히트맵을 격자 크기(grid_size())의 BGRA 이미지로 그림
+   * - 가장 뜨거운 칸을 기준으로 정규화하여 색(파랑 → 빨강)과 불투명도를 정함
+   * - drawables::Overlay의 buffer로 쓰면 화면 크기로 늘려 반투명하게 그림
+   * @param bgra 출력 버퍼 (CV_8UC4, 크기나 타입이 다를 때만 재할당)
+   * @return 이전 render() 이후 바뀐 것이 없으면 false (bgra를 건드리지 않음)
+   */
+  bool render(cv::Mat* bgra);
+
+  void clear(); // 히트맵과 통계 초기화
+
+  // 영역별 고정/도약 통계
+  const std::vector<RegionStats>& region_stats() const { return regions_; }
+
+  // 화면 좌표의 현재 히트맵 값 (최댓값 1 기준)
+  float value(int x, int y) const;
+
+  cv::Size grid_size() const { return {cols_, rows_}; }
+  const Options& options() const { return options_; }
+
+  Stats stats() const;
+
+ private:
+  std::size_t index(int gx, int gy) const {
+    return (static_cast<std::size_t>(gy / kTileSize) * tiles_x_ + gx / kTileSize) * kTileSize * kTileSize +
+           (gy % kTileSize) * kTileSize + gx % kTileSize;
+  }
+
+  void process(const GazeSample& sample); // 시선 하나 반영
+  void splat(float x, float y, float weight); // 가우시안 더하기
+  float weight_at(std::uint64_t timestamp); // 시간에 따른 가중치 (필요하면 정규화)
+  void rescale(float factor); // 격자 전체에 곱하기
+  void end_fixation();
+  int region_of(float x, float y) const; // 영역 번호 (화면 밖이면 -1)
+
+  Options options_;
+  int cols_ = 0;
+  int rows_ = 0;
+  int tiles_x_ = 0;
+  int radius_ = 0;                      // 가우시안 반경 (칸)
+  float inv_two_sigma2_ = 0.f;          // 1 / (2 * sigma^2) (칸 단위)
+  std::vector<float> grid_;             // 타일 단위 격자
+  std::vector<float> kx_;               // 가로 가우시안 (시선마다 다시 계산)
+  std::vector<float> ky_;               // 세로 가우시안
+  std::vector<std::uint8_t> row_;       // render() 행 버퍼 (색 번호)
+  std::uint8_t lut_[256][4];            // 색 번호 → BGRA
+
+  float peak_ = 0.f;                    // 격자의 최댓값
+  std::uint64_t base_time_ = 0;         // 가중치 1의 기준 시각 (ms)
+  std::uint64_t last_time_ = 0;         // 마지막 시선 시각 (ms)
+  bool has_time_ = false;
+  bool dirty_ = true;                   // 마지막 render() 이후 바뀌었는지
+
+  // 고정/도약 상태
+  bool in_fixation_ = false;
+  std::uint64_t fixation_start_ = 0;
+  std::uint64_t fixation_end_ = 0;
+  double fixation_sum_x_ = 0;
+  double fixation_sum_y_ = 0;
+  std::uint64_t fixation_count_ = 0;
+  bool has_last_fixation_ = false;
+  cv::Point2f last_fixation_;           // 마지막 고정 중심
+  bool in_saccade_ = false;
+  int saccade_region_ = -1;             // 진행 중인 도약의 출발 영역
+  cv::Point2f saccade_origin_;          // 진행 중인 도약의 출발 위치
+  std::vector<RegionStats> regions_;
+
+  MpscQueue<GazeSample> queue_;
+  raii_connection connection_;
+
+  std::atomic<std::uint64_t> samples_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> fixations_{0};
+  std::atomic<std::uint64_t> saccades_{0};
+  std::atomic<std::uint64_t> renders_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_HEATMAP_H_
@@ -0,0 +1,383 @@
+#include "gaze_log.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace sample {
+
+namespace {
+
+constexpr char kFileMagic[4] = {'E', 'Y', 'G', 'L'};
+constexpr char kIndexMagic[4] = {'E', 'Y', 'G', 'I'};
+
+// 8바이트 배수로 올림
+inline std::uint64_t align8(std::uint64_t size) {
+  return (size + 7) & ~std::uint64_t{7};
+}
+
+inline bool known_type(std::uint32_t type) {
+  return type == static_cast<std::uint32_t>(GazeLogRecordType::kMetrics) ||
+         type == static_cast<std::uint32_t>(GazeLogRecordType::kFrame);
+}
+
+// 색인 항목이 가리키는 레코드가 [파일 헤더, end) 안에 있고 레코드 헤더와 일치하는지 확인
+bool valid_entry(const std::uint8_t* data, const GazeLogIndexEntry& entry, std::uint64_t end) {
+  if (!known_type(entry.type) || entry.offset < sizeof(GazeLogFileHeader) || entry.offset > end ||
+      end - entry.offset < sizeof(GazeLogRecordHeader) + align8(entry.size))
+    return false;
+
+  GazeLogRecordHeader header;
+  std::memcpy(&header, data + entry.offset, sizeof(header));
+  return header.type == entry.type && header.size == entry.size;
+}
+
+} // namespace
+
+// **GazeLogWriter 클래스**
+GazeLogWriter::~GazeLogWriter() {
+  close();
+}
+
+bool GazeLogWriter::open(const std::string& path) {
+  close();
+
+  std::lock_guard<std::mutex> lck(mutex_);
+  file_.open(path, std::ios::binary | std::ios::trunc);
+  if (!file_.is_open())
+    return false;
+
+  GazeLogFileHeader header{};
+  std::memcpy(header.magic, kFileMagic, sizeof(header.magic));
+  header.version = kGazeLogVersion;
+  header.metrics_size = sizeof(GazeLogMetrics);
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  offset_ = sizeof(header);
+  index_.clear();
+  failed_ = !file_.good();
+  return !failed_;
+}
+
+bool GazeLogWriter::is_open() const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  return file_.is_open();
+}
+
+bool GazeLogWriter::failed() const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  return failed_;
+}
+
+// 쓰기에 실패했으면 색인을 쓰지 않고 닫음 (읽는 쪽은 footer가 없으므로 완전한 레코드까지 색인을 다시 만듦)
+bool GazeLogWriter::close() {
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (!file_.is_open())
+    return !failed_;
+
+  if (failed_) {
+    file_.close();
+    index_.clear();
+    return false;
+  }
+
+  GazeLogFooter footer{};
+  footer.index_offset = offset_;
+  footer.index_count = index_.size();
+  std::memcpy(footer.magic, kIndexMagic, sizeof(footer.magic));
+  footer.version = kGazeLogVersion;
+
+  file_.write(reinterpret_cast<const char*>(index_.data()),
+              static_cast<std::streamsize>(index_.size() * sizeof(GazeLogIndexEntry)));
+  file_.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+  file_.close(); // 닫을 때 남은 버퍼를 내보내므로 그 결과까지 확인
+  failed_ = file_.fail();
+  index_.clear();
+  return !failed_;
+}
+
+bool GazeLogWriter::write_metrics(std::int64_t time_ns, const GazeLogMetrics& metrics) {
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (!file_.is_open() || failed_)
+    return false;
+
+  begin_record(GazeLogRecordType::kMetrics, time_ns, sizeof(metrics));
+  file_.write(reinterpret_cast<const char*>(&metrics), sizeof(metrics));
+  return end_record(sizeof(metrics));
+}
+
+bool GazeLogWriter::write_frame(std::int64_t time_ns, const cv::Mat& frame) {
+  if (frame.empty())
+    return false;
+
+  GazeLogFrameHeader header{};
+  header.rows = frame.rows;
+  header.cols = frame.cols;
+  header.type = frame.type();
+  const std::size_t row_bytes = frame.cols * frame.elemSize();
+  const auto size = static_cast<std::uint32_t>(sizeof(header) + row_bytes * frame.rows);
+
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (!file_.is_open() || failed_)
+    return false;
+
+  begin_record(GazeLogRecordType::kFrame, time_ns, size);
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (frame.isContinuous()) {
+    file_.write(reinterpret_cast<const char*>(frame.data), static_cast<std::streamsize>(row_bytes * frame.rows));
+  } else {
+    for (int y = 0; y < frame.rows; ++y)
+      file_.write(reinterpret_cast<const char*>(frame.ptr(y)), static_cast<std::streamsize>(row_bytes));
+  }
+  return end_record(size);
+}
+
+void GazeLogWriter::begin_record(GazeLogRecordType type, std::int64_t time_ns, std::uint32_t size) {
+  GazeLogRecordHeader header{};
+  header.type = static_cast<std::uint32_t>(type);
+  header.size = size;
+  header.time_ns = time_ns;
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  pending_ = GazeLogIndexEntry{};
+  pending_.time_ns = time_ns;
+  pending_.offset = offset_;
+  pending_.type = header.type;
+  pending_.size = size;
+}
+
+// 레코드의 모든 쓰기가 성공했을 때만 색인에 넣음 (실패하면 이후 기록을 멈춤)
+bool GazeLogWriter::end_record(std::uint32_t size) {
+  static const char padding[8] = {};
+  const auto padded = align8(size);
+  file_.write(padding, static_cast<std::streamsize>(padded - size));
+  if (!file_.good()) {
+    failed_ = true;
+    return false;
+  }
+
+  index_.push_back(pending_);
+  offset_ += sizeof(GazeLogRecordHeader) + padded;
+  return true;
+}
+
+// **GazeLogReader 클래스**
+GazeLogReader::~GazeLogReader() {
+  close();
+}
+
+bool GazeLogReader::open(const std::string& path) {
+  close();
+  if (!map_file(path))
+    return false;
+
+  GazeLogFileHeader header;
+  if (length_ < sizeof(header)) {
+    close();
+    return false;
+  }
+  std::memcpy(&header, data_, sizeof(header));
+  if (std::memcmp(header.magic, kFileMagic, sizeof(header.magic)) != 0 ||
+      header.version != kGazeLogVersion || header.metrics_size != sizeof(GazeLogMetrics)) {
+    close();
+    return false;
+  }
+
+  indexed_ = load_index();
+  if (!indexed_)
+    scan_index();
+
+  // 여러 스레드가 기록하므로 파일 순서와 시간 순서가 다를 수 있음
+  std::stable_sort(index_.begin(), index_.end(), [](const GazeLogIndexEntry& a, const GazeLogIndexEntry& b) {
+    return a.time_ns < b.time_ns;
+  });
+  return true;
+}
+
+void GazeLogReader::close() {
+  unmap_file();
+  index_.clear();
+  indexed_ = false;
+}
+
+std::size_t GazeLogReader::seek(std::int64_t time_ns) const {
+  const auto it = std::lower_bound(index_.begin(), index_.end(), time_ns,
+                                   [](const GazeLogIndexEntry& entry, std::int64_t t) { return entry.time_ns < t; });
+  return static_cast<std::size_t>(it - index_.begin());
+}
+
+bool GazeLogReader::metrics(std::size_t i, GazeLogMetrics* metrics) const {
+  const auto& e = index_[i];
+  if (e.type != static_cast<std::uint32_t>(GazeLogRecordType::kMetrics) || e.size != sizeof(GazeLogMetrics))
+    return false;
+  std::memcpy(metrics, payload(i), sizeof(GazeLogMetrics));
+  return true;
+}
+
+cv::Mat GazeLogReader::frame(std::size_t i) const {
+  const auto& e = index_[i];
+  if (e.type != static_cast<std::uint32_t>(GazeLogRecordType::kFrame) || e.size < sizeof(GazeLogFrameHeader))
+    return cv::Mat();
+
+  const auto p = payload(i);
+  GazeLogFrameHeader header;
+  std::memcpy(&header, p, sizeof(header));
+  if (header.rows <= 0 || header.cols <= 0 || header.type != CV_MAT_TYPE(header.type))
+    return cv::Mat();
+
+  // 픽셀이 레코드 안에 들어 있는지 확인 (곱셈이 넘치지 않도록 픽셀 수부터 비교)
+  const auto pixels = static_cast<std::uint64_t>(header.rows) * static_cast<std::uint64_t>(header.cols);
+  const std::uint64_t available = e.size - sizeof(header);
+  if (pixels > available || pixels * CV_ELEM_SIZE(header.type) > available)
+    return cv::Mat();
+
+  // 읽기 전용 매핑을 가리킴 (cv::Mat에는 const 데이터가 없으므로 형 변환만 함)
+  return cv::Mat(header.rows, header.cols, header.type, const_cast<std::uint8_t*>(p + sizeof(header)));
+}
+
+const std::uint8_t* GazeLogReader::payload(std::size_t i) const {
+  return data_ + index_[i].offset + sizeof(GazeLogRecordHeader);
+}
+
+bool GazeLogReader::load_index() {
+  GazeLogFooter footer;
+  if (length_ < sizeof(GazeLogFileHeader) + sizeof(footer))
+    return false;
+  std::memcpy(&footer, data_ + length_ - sizeof(footer), sizeof(footer));
+  if (std::memcmp(footer.magic, kIndexMagic, sizeof(footer.magic)) != 0 || footer.version != kGazeLogVersion)
+    return false;
+
+  // 색인은 레코드 뒤, footer 바로 앞에 정확히 index_count개 (곱셈이 넘치지 않도록 나눗셈으로 확인)
+  const std::uint64_t records_end = footer.index_offset;
+  const std::uint64_t index_end = length_ - sizeof(footer);
+  if (records_end < sizeof(GazeLogFileHeader) || records_end > index_end ||
+      (index_end - records_end) % sizeof(GazeLogIndexEntry) != 0 ||
+      (index_end - records_end) / sizeof(GazeLogIndexEntry) != footer.index_count)
+    return false;
+
+  index_.resize(static_cast<std::size_t>(footer.index_count));
+  std::memcpy(index_.data(), data_ + records_end, index_.size() * sizeof(GazeLogIndexEntry));
+
+  // 모든 항목이 레코드 영역 안의 실제 레코드를 가리켜야 함
+  for (const auto& entry : index_) {
+    if (!valid_entry(data_, entry, records_end)) {
+      index_.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+// 비정상 종료로 색인이 없을 때: 완전한 레코드까지만 색인에 넣음
+void GazeLogReader::scan_index() {
+  index_.clear();
+  std::uint64_t offset = sizeof(GazeLogFileHeader);
+  while (offset + sizeof(GazeLogRecordHeader) <= length_) {
+    GazeLogRecordHeader header;
+    std::memcpy(&header, data_ + offset, sizeof(header));
+    const auto next = offset + sizeof(header) + align8(header.size);
+    if (!known_type(header.type))
+      break;
+    if (next > length_)
+      break;
+
+    GazeLogIndexEntry entry{};
+    entry.time_ns = header.time_ns;
+    entry.offset = offset;
+    entry.type = header.type;
+    entry.size = header.size;
+    index_.push_back(entry);
+    offset = next;
+  }
+}
+
+#if defined(_WIN32)
+
+bool GazeLogReader::map_file(const std::string& path) {
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    CloseHandle(file);
+    return false;
+  }
+
+  const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  file_handle_ = file;
+  mapping_handle_ = mapping;
+  data_ = static_cast<const std::uint8_t*>(view);
+  length_ = static_cast<std::size_t>(size.QuadPart);
+  return true;
+}
+
+void GazeLogReader::unmap_file() {
+  if (data_ != nullptr)
+    UnmapViewOfFile(data_);
+  if (mapping_handle_ != nullptr)
+    CloseHandle(mapping_handle_);
+  if (file_handle_ != nullptr)
+    CloseHandle(file_handle_);
+  data_ = nullptr;
+  length_ = 0;
+  mapping_handle_ = nullptr;
+  file_handle_ = nullptr;
+}
+
+#else
+
+bool GazeLogReader::map_file(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+
+  void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // 매핑은 파일 디스크립터를 닫아도 유지됨
+  if (view == MAP_FAILED)
+    return false;
+
+  data_ = static_cast<const std::uint8_t*>(view);
+  length_ = static_cast<std::size_t>(st.st_size);
+  return true;
+}
+
+void GazeLogReader::unmap_file() {
+  if (data_ != nullptr)
+    ::munmap(const_cast<std::uint8_t*>(data_), length_);
+  data_ = nullptr;
+  length_ = 0;
+}
+
+#endif
+
+} // namespace sample
@@ -0,0 +1,177 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_LOG_H_
+#define EYEDID_CPP_SAMPLE_GAZE_LOG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "eyedid/gaze_tracker.h"
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * 시선 기록 파일(gaze log) 형식
+ *
+ *   [GazeLogFileHeader]
+ *   [GazeLogRecordHeader][payload (8바이트 배수로 채움)] ...
+ *   [GazeLogIndexEntry] * index_count
+ *   [GazeLogFooter]
+ *
+ * - 모든 구조체는 기록한 기기의 바이트 순서를 그대로 사용
+ * - 레코드는 8바이트 경계에 놓이므로 파일을 메모리에 매핑한 뒤 그대로 읽을 수 있음
+ * - 색인(index)과 footer는 close() 시 기록되며, 없으면(비정상 종료) 읽을 때 레코드를 훑어 색인을 다시 만듦
+ * - 레코드는 기록된 순서대로 놓이며, 읽을 때 색인을 시간 순으로 정렬
+ */
+constexpr std::uint32_t kGazeLogVersion = 1;
+
+// 레코드 종류
+enum class GazeLogRecordType : std::uint32_t {
+  kMetrics = 1, // OnMetrics 데이터 (GazeLogMetrics)
+  kFrame = 2,   // 카메라 프레임 (GazeLogFrameHeader + 픽셀)
+};
+
+// OnMetrics 한 번의 데이터
+struct GazeLogMetrics {
+  std::uint64_t timestamp = 0; // SDK 타임스탬프 (ms)
+  EyedidGazeData gaze;
+  EyedidFaceData face;
+  EyedidBlinkData blink;
+  EyedidUserStatusData user_status;
+};
+
+struct GazeLogFileHeader {
+  char magic[4];              // "EYGL"
+  std::uint32_t version;      // kGazeLogVersion
+  std::uint32_t metrics_size; // sizeof(GazeLogMetrics) (SDK 구조체 크기가 같은지 확인용)
+  std::uint32_t reserved;
+};
+
+struct GazeLogRecordHeader {
+  std::uint32_t type;         // GazeLogRecordType
+  std::uint32_t size;         // payload 크기 (채움 바이트 제외)
+  std::int64_t time_ns;       // 기록 시작부터의 경과 시간 (ns)
+};
+
+struct GazeLogFrameHeader {
+  std::int32_t rows;
+  std::int32_t cols;
+  std::int32_t type;          // OpenCV 타입 (예: CV_8UC3)
+  std::int32_t reserved;
+};
+
+struct GazeLogIndexEntry {
+  std::int64_t time_ns;       // 레코드 시간
+  std::uint64_t offset;       // 레코드 헤더의 파일 위치
+  std::uint32_t type;         // GazeLogRecordType
+  std::uint32_t size;         // payload 크기
+};
+
+struct GazeLogFooter {
+  std::uint64_t index_offset; // 색인 시작 위치
+  std::uint64_t index_count;  // 색인 항목 수
+  char magic[4];              // "EYGI"
+  std::uint32_t version;
+};
+
+static_assert(std::is_trivially_copyable<GazeLogMetrics>::value, "GazeLogMetrics must be trivially copyable");
+static_assert(sizeof(GazeLogRecordHeader) % 8 == 0 && sizeof(GazeLogFrameHeader) % 8 == 0 &&
+              sizeof(GazeLogIndexEntry) % 8 == 0, "gaze log structures must keep 8-byte alignment");
+
+/**
+ * GazeLogWriter 클래스:
+ * - 시선 기록 파일 작성
+ * - 여러 스레드에서 write_*()를 호출할 수 있음 (내부 mutex로 직렬화)
+ * - 쓰기에 한 번 실패하면(디스크 부족 등) 이후의 기록은 모두 버리고 false를 반환
+ *   (그때까지 기록한 레코드는 읽을 때 색인을 다시 만들어 사용할 수 있음)
+ */
+class GazeLogWriter {
+ public:
+  GazeLogWriter() = default;
+  ~GazeLogWriter();
+
+  GazeLogWriter(const GazeLogWriter&) = delete;
+  GazeLogWriter& operator=(const GazeLogWriter&) = delete;
+
+  bool open(const std::string& path);
+  bool is_open() const;
+  bool failed() const; // 쓰기에 실패한 적이 있음 (open()에서 초기화)
+
+  // 색인과 footer를 기록한 뒤 파일을 닫음 (쓰기에 실패한 적이 있으면 false)
+  bool close();
+
+  // 레코드 기록 (파일이 열려 있지 않거나 쓰기에 실패하면 false)
+  bool write_metrics(std::int64_t time_ns, const GazeLogMetrics& metrics);
+  bool write_frame(std::int64_t time_ns, const cv::Mat& frame); // 연속 메모리가 아니면 행 단위로 기록
+
+ private:
+  // mutex_를 잡은 상태에서 호출
+  void begin_record(GazeLogRecordType type, std::int64_t time_ns, std::uint32_t size);
+  bool end_record(std::uint32_t size); // 레코드 전체를 썼으면 색인에 추가
+
+  mutable std::mutex mutex_;
+  std::ofstream file_;
+  bool failed_ = false;
+  std::uint64_t offset_ = 0;
+  GazeLogIndexEntry pending_{}; // begin_record()로 시작한 레코드의 색인 항목
+  std::vector<GazeLogIndexEntry> index_;
+};
+
+/**
+ * GazeLogReader 클래스:
+ * - 시선 기록 파일을 메모리에 매핑하여 읽음 (읽기 전용)
+ * - frame()은 매핑된 메모리를 가리키는 cv::Mat을 반환하므로 복사가 없음 (reader가 열려 있는 동안 유효)
+ *   읽기 전용으로 매핑되어 있으므로 픽셀을 수정하면 안 됨 (수정하거나 reader를 닫은 뒤에도 쓰려면 clone())
+ * - 파일 내용은 신뢰하지 않음: 색인 항목이 파일 범위를 벗어나면 레코드를 훑어 색인을 다시 만들고,
+ *   프레임 크기가 레코드보다 크면 frame()이 빈 cv::Mat을 반환
+ */
+class GazeLogReader {
+ public:
+  GazeLogReader() = default;
+  ~GazeLogReader();
+
+  GazeLogReader(const GazeLogReader&) = delete;
+  GazeLogReader& operator=(const GazeLogReader&) = delete;
+
+  bool open(const std::string& path);
+  void close();
+  bool is_open() const { return data_ != nullptr; }
+
+  // footer의 색인을 사용했으면 true, 레코드를 훑어 색인을 다시 만들었으면 false
+  bool indexed() const { return indexed_; }
+
+  std::size_t size() const { return index_.size(); } // 레코드 수
+  const GazeLogIndexEntry& entry(std::size_t i) const { return index_[i]; }
+  std::int64_t duration_ns() const { return index_.empty() ? 0 : index_.back().time_ns; }
+
+  // time_ns 이후의 첫 레코드 위치
+  std::size_t seek(std::int64_t time_ns) const;
+
+  // i번째 레코드를 읽음 (종류가 다르면 false / 빈 cv::Mat)
+  bool metrics(std::size_t i, GazeLogMetrics* metrics) const;
+  cv::Mat frame(std::size_t i) const;
+
+ private:
+  bool map_file(const std::string& path);
+  void unmap_file();
+  bool load_index();  // footer의 색인 읽기
+  void scan_index();  // 레코드를 훑어 색인 만들기
+  const std::uint8_t* payload(std::size_t i) const;
+
+  const std::uint8_t* data_ = nullptr;
+  std::size_t length_ = 0;
+  bool indexed_ = false;
+  std::vector<GazeLogIndexEntry> index_;
+#if defined(_WIN32)
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_LOG_H_
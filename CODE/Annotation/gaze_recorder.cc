@@ -0,0 +1,115 @@
+#include "gaze_recorder.h"
+
+namespace sample {
+
+constexpr std::size_t GazeRecorder::kDefaultCapacity;
+
+GazeRecorder::GazeRecorder(std::size_t capacity)
+: queue_(capacity) {}
+
+GazeRecorder::~GazeRecorder() {
+  stop();
+}
+
+bool GazeRecorder::start(const std::string& path, TrackerManager& tracker_manager, FrameRing* frames) {
+  stop();
+  if (!writer_.open(path))
+    return false;
+
+  start_time_ = std::chrono::steady_clock::now();
+  stop_ = false;
+  recording_.store(true);
+  thread_ = std::thread([this]() {
+    run_impl();
+  });
+
+  metrics_connection_ = tracker_manager.on_metrics_.connect(
+      [this](std::uint64_t timestamp, const EyedidGazeData& gaze, const EyedidFaceData& face,
+             const EyedidBlinkData& blink, const EyedidUserStatusData& user_status) {
+        push(timestamp, gaze, face, blink, user_status);
+      });
+
+  if (frames != nullptr) {
+    // 디스크 쓰기가 카메라를 막지 않도록 몇 프레임까지만 쌓아 두고 나머지는 건너뜀
+    frame_consumer_.reset(new FrameConsumerThread(
+        *frames, "gaze_recorder", FrameRing::DropPolicy::kNDeep,
+        [this](const cv::Mat& frame) {
+          if (writer_.write_frame(elapsed_ns(), frame))
+            frames_recorded_.fetch_add(1, std::memory_order_relaxed);
+          else
+            write_failures_.fetch_add(1, std::memory_order_relaxed);
+        }, 3));
+  }
+  return true;
+}
+
+bool GazeRecorder::stop() {
+  metrics_connection_ = connection(); // 더 이상 데이터를 받지 않음
+  frame_consumer_.reset();
+
+  recording_.store(false);
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  if (thread_.joinable())
+    thread_.join();
+
+  return writer_.close();
+}
+
+GazeRecorder::Stats GazeRecorder::stats() const {
+  Stats stats;
+  stats.metrics_recorded = metrics_recorded_.load(std::memory_order_relaxed);
+  stats.metrics_dropped = metrics_dropped_.load(std::memory_order_relaxed);
+  stats.frames_recorded = frames_recorded_.load(std::memory_order_relaxed);
+  stats.write_failures = write_failures_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+std::int64_t GazeRecorder::elapsed_ns() const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count();
+}
+
+void GazeRecorder::push(std::uint64_t timestamp, const EyedidGazeData& gaze, const EyedidFaceData& face,
+                        const EyedidBlinkData& blink, const EyedidUserStatusData& user_status) {
+  if (!recording_.load(std::memory_order_relaxed))
+    return;
+
+  Entry entry;
+  entry.time_ns = elapsed_ns();
+  entry.metrics.timestamp = timestamp;
+  entry.metrics.gaze = gaze;
+  entry.metrics.face = face;
+  entry.metrics.blink = blink;
+  entry.metrics.user_status = user_status;
+  if (!queue_.try_push(std::move(entry)))
+    metrics_dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 기록 스레드
+// - 생산자(SDK 콜백)는 알림을 보내지 않으므로 주기적으로 깨어나 큐를 비움
+void GazeRecorder::run_impl() {
+  std::unique_lock<std::mutex> lck(mutex_);
+  while (!stop_) {
+    cv_.wait_for(lck, std::chrono::milliseconds(50), [this]() { return stop_; });
+    lck.unlock();
+    drain();
+    lck.lock();
+  }
+  lck.unlock();
+  drain();
+}
+
+void GazeRecorder::drain() {
+  Entry entry;
+  while (queue_.try_pop(&entry)) {
+    if (writer_.write_metrics(entry.time_ns, entry.metrics))
+      metrics_recorded_.fetch_add(1, std::memory_order_relaxed);
+    else
+      write_failures_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+} // namespace sample
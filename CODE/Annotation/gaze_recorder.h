@@ -0,0 +1,98 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_RECORDER_H_
+#define EYEDID_CPP_SAMPLE_GAZE_RECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "frame_ring.h"
+#include "gaze_log.h"
+#include "mpsc_queue.h"
+#include "simple_signal.h"
+#include "tracker_manager.h"
+
+namespace sample {
+
+/**
+ * GazeRecorder 클래스:
+ * - TrackerManager::on_metrics_의 모든 데이터를 시선 기록 파일(gaze log)로 저장
+ * - FrameRing을 지정하면 카메라 프레임도 함께 저장 (별도의 소비자 스레드, 디스크가 느리면 프레임을 건너뜀)
+ * - SDK 콜백 스레드에서는 잠금 없는 큐에 넣기만 하고, 파일 쓰기는 기록 스레드에서 수행
+ * - start()/stop()은 한 스레드에서 호출해야 함
+ */
+class GazeRecorder {
+ public:
+  // 기록 통계
+  struct Stats {
+    std::uint64_t metrics_recorded = 0; // 파일에 기록한 OnMetrics 수
+    std::uint64_t metrics_dropped = 0;  // 큐가 가득 차서 버린 OnMetrics 수
+    std::uint64_t frames_recorded = 0;  // 파일에 기록한 프레임 수
+    std::uint64_t write_failures = 0;   // 파일 쓰기에 실패해 버린 레코드 수 (디스크 부족 등)
+  };
+
+  static constexpr std::size_t kDefaultCapacity = 1024;
+
+  explicit GazeRecorder(std::size_t capacity = kDefaultCapacity);
+  ~GazeRecorder();
+
+  GazeRecorder(const GazeRecorder&) = delete;
+  GazeRecorder& operator=(const GazeRecorder&) = delete;
+
+  /**
+   * 기록 시작 (이미 기록 중이면 이전 기록을 마친 뒤 새로 시작)
+   * @param path            기록 파일 경로
+   * @param tracker_manager OnMetrics 데이터를 가져올 TrackerManager
+   * @param frames          프레임도 기록하려면 카메라의 FrameRing (nullptr이면 기록하지 않음)
+   * @return 파일을 열었으면 true
+   */
+  bool start(const std::string& path, TrackerManager& tracker_manager, FrameRing* frames = nullptr);
+
+  // 남은 데이터를 기록하고 색인을 쓴 뒤 파일을 닫음 (쓰기에 실패한 적이 있으면 false)
+  bool stop();
+
+  bool recording() const { return recording_.load(std::memory_order_relaxed); }
+
+  Stats stats() const;
+
+ private:
+  // 큐에 넣는 항목
+  struct Entry {
+    std::int64_t time_ns = 0;
+    GazeLogMetrics metrics;
+  };
+
+  std::int64_t elapsed_ns() const; // 기록 시작부터의 경과 시간
+
+  void push(std::uint64_t timestamp, const EyedidGazeData& gaze, const EyedidFaceData& face,
+            const EyedidBlinkData& blink, const EyedidUserStatusData& user_status); // SDK 콜백 스레드
+  void run_impl(); // 기록 스레드 실행 로직
+  void drain();    // 큐의 데이터를 파일에 기록
+
+  GazeLogWriter writer_;
+  MpscQueue<Entry> queue_;
+  std::chrono::steady_clock::time_point start_time_;
+
+  raii_connection metrics_connection_;
+  std::unique_ptr<FrameConsumerThread> frame_consumer_;
+
+  std::mutex mutex_; // 종료 대기용
+  std::condition_variable cv_;
+  bool stop_ = false;
+  std::atomic_bool recording_{false};
+  std::thread thread_;
+
+  std::atomic<std::uint64_t> metrics_recorded_{0};
+  std::atomic<std::uint64_t> metrics_dropped_{0};
+  std::atomic<std::uint64_t> frames_recorded_{0};
+  std::atomic<std::uint64_t> write_failures_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_RECORDER_H_
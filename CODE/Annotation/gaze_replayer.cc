@@ -0,0 +1,132 @@
+#include "gaze_replayer.h"
+
+namespace sample {
+
+// TrackerManager에 넣는 추적기 (재생 스레드가 Link를 통해 콜백을 호출)
+class GazeReplayer::Tracker : public FrameTracker {
+ public:
+  explicit Tracker(std::shared_ptr<Link> link) : link_(std::move(link)) {}
+
+  ~Tracker() override {
+    setTrackingCallback(nullptr); // 진행 중인 OnMetrics가 끝날 때까지 대기
+  }
+
+  void setTrackingCallback(eyedid::ITrackingCallback* callback) override {
+    std::lock_guard<std::mutex> lck(link_->mutex);
+    link_->callback = callback;
+  }
+
+  // 재생 중에는 기록된 결과를 사용하므로 프레임은 버림
+  bool addFrame(std::int64_t, const std::uint8_t*, int, int) override { return true; }
+
+ private:
+  std::shared_ptr<Link> link_;
+};
+
+GazeReplayer::GazeReplayer(const GazeLogReader& reader)
+: reader_(reader), link_(std::make_shared<Link>()) {}
+
+GazeReplayer::~GazeReplayer() {
+  stop();
+}
+
+void GazeReplayer::start(double speed, bool loop) {
+  stop();
+
+  stop_ = false;
+  metrics_.store(0, std::memory_order_relaxed);
+  frames_.store(0, std::memory_order_relaxed);
+  max_lag_us_.store(0, std::memory_order_relaxed);
+  running_.store(true);
+  thread_ = std::thread([this, speed, loop]() {
+    run_impl(speed, loop);
+    running_.store(false);
+  });
+}
+
+void GazeReplayer::stop() {
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  join();
+}
+
+void GazeReplayer::join() {
+  if (thread_.joinable())
+    thread_.join();
+}
+
+std::unique_ptr<FrameTracker> GazeReplayer::make_tracker() {
+  link_ = std::make_shared<Link>(); // 이전에 만든 추적기는 연결 해제
+  return std::unique_ptr<FrameTracker>(new Tracker(link_));
+}
+
+GazeReplayer::Stats GazeReplayer::stats() const {
+  Stats stats;
+  stats.metrics = metrics_.load(std::memory_order_relaxed);
+  stats.frames = frames_.load(std::memory_order_relaxed);
+  stats.max_lag_us = max_lag_us_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 재생 스레드
+// - 각 레코드의 예정 시각(시작 시각 + time_ns / speed)까지 기다린 뒤 발행
+// - 예정 시각은 시작 시각 기준으로 계산하므로 발행이 늦어져도 오차가 누적되지 않음
+void GazeReplayer::run_impl(double speed, bool loop) {
+  using clock = std::chrono::steady_clock;
+
+  do {
+    const auto start_time = clock::now();
+    for (std::size_t i = 0; i < reader_.size(); ++i) {
+      if (speed > 0) {
+        const auto offset = std::chrono::nanoseconds(
+            static_cast<std::int64_t>(static_cast<double>(reader_.entry(i).time_ns) / speed));
+        const auto deadline = start_time + std::chrono::duration_cast<clock::duration>(offset);
+        if (!wait_until(deadline))
+          return;
+
+        const auto lag = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - deadline).count();
+        if (lag > max_lag_us_.load(std::memory_order_relaxed))
+          max_lag_us_.store(lag, std::memory_order_relaxed);
+      } else {
+        std::lock_guard<std::mutex> lck(mutex_);
+        if (stop_)
+          return;
+      }
+      emit(i);
+    }
+  } while (loop && reader_.size() > 0);
+}
+
+bool GazeReplayer::wait_until(std::chrono::steady_clock::time_point deadline) {
+  std::unique_lock<std::mutex> lck(mutex_);
+  return !cv_.wait_until(lck, deadline, [this]() { return stop_; });
+}
+
+void GazeReplayer::emit(std::size_t i) {
+  const auto type = static_cast<GazeLogRecordType>(reader_.entry(i).type);
+
+  if (type == GazeLogRecordType::kFrame) {
+    const auto frame = reader_.frame(i);
+    if (!frame.empty()) {
+      on_frame_(frame);
+      frames_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+
+  GazeLogMetrics m;
+  if (!reader_.metrics(i, &m))
+    return;
+
+  // SDK 콜백과 같은 경로로 처리 (추적기가 연결되지 않았으면 버림)
+  std::lock_guard<std::mutex> lck(link_->mutex);
+  if (link_->callback == nullptr)
+    return;
+  link_->callback->OnMetrics(m.timestamp, m.gaze, m.face, m.blink, m.user_status);
+  metrics_.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace sample
@@ -0,0 +1,100 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_REPLAYER_H_
+#define EYEDID_CPP_SAMPLE_GAZE_REPLAYER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "frame_tracker.h"
+#include "gaze_log.h"
+#include "opencv2/opencv.hpp"
+#include "simple_signal.h"
+
+namespace sample {
+
+/**
+ * GazeReplayer 클래스:
+ * - 시선 기록 파일(GazeLogReader)을 원래 속도 또는 배속으로 재생
+ * - OnMetrics 레코드는 make_tracker()로 만든 추적기를 통해 TrackerManager::OnMetrics로 전달
+ *   (SDK 결과와 같은 경로이므로 시선 필터, AOI 판정, 기록, on_metrics_/on_gaze_/on_gaze_sample_이 모두 그대로 동작)
+ *     auto tracker_manager = std::make_shared<TrackerManager>();
+ *     tracker_manager->initialize(replayer.make_tracker());
+ * - 카메라 프레임 레코드는 on_frame_으로 발행
+ * - 같은 파일과 속도면 항상 같은 순서로 발행되므로 필터/분석 로직을 카메라 없이 반복 검증할 수 있음
+ * - 기록 파일에는 캡처 정보가 없으므로 GazeSample의 frame_sequence/source_id/capture_ns는 0
+ * - reader는 재생이 끝날 때까지 열려 있어야 함
+ */
+class GazeReplayer {
+ public:
+  // 재생 통계
+  struct Stats {
+    std::uint64_t metrics = 0;    // 추적기로 전달한 OnMetrics 수
+    std::uint64_t frames = 0;     // 발행한 프레임 수
+    std::int64_t max_lag_us = 0;  // 예정 시각보다 늦게 발행된 최대 시간 (us)
+  };
+
+  explicit GazeReplayer(const GazeLogReader& reader);
+  ~GazeReplayer();
+
+  GazeReplayer(const GazeReplayer&) = delete;
+  GazeReplayer& operator=(const GazeReplayer&) = delete;
+
+  /**
+   * 재생 시작 (재생 중이면 멈춘 뒤 처음부터 다시 시작)
+   * @param speed 재생 배속 (1.0: 원래 속도, 0 이하: 기다리지 않고 최대한 빠르게)
+   * @param loop  끝까지 재생하면 처음부터 반복
+   */
+  void start(double speed = 1.0, bool loop = false);
+  void stop(); // 재생을 멈추고 스레드 종료 대기
+  void join(); // 재생이 끝날 때까지 대기 (loop이면 stop()이 호출될 때까지)
+
+  bool running() const { return running_.load(); }
+
+  /**
+   * 재생한 OnMetrics 레코드를 받을 추적기 (TrackerManager::initialize()에 넘김, start() 전에 호출)
+   * - 추적기는 마지막으로 만든 것 하나만 연결됨
+   * - 추적기의 addFrame()은 프레임을 받기만 하고 버림
+   * - 추적기는 GazeReplayer보다 오래 남아도 되며, 추적기가 소멸되면 이후 레코드는 전달하지 않음
+   */
+  std::unique_ptr<FrameTracker> make_tracker();
+
+  Stats stats() const;
+
+  // 기록된 카메라 프레임
+  // - 읽기 전용으로 매핑된 파일을 가리키므로 복사가 없으며, 픽셀을 수정하면 안 됨 (보관하거나 수정하려면 clone())
+  signal<void(const cv::Mat&)> on_frame_;
+
+ private:
+  class Tracker;
+
+  // 재생 스레드와 추적기를 잇는 연결 (둘 중 먼저 소멸되는 쪽이 있어도 안전하도록 공유)
+  struct Link {
+    std::mutex mutex; // 콜백 교체와 호출 보호 (추적기 소멸은 진행 중인 호출이 끝날 때까지 대기)
+    eyedid::ITrackingCallback* callback = nullptr;
+  };
+
+  void run_impl(double speed, bool loop); // 재생 스레드 실행 로직
+  bool wait_until(std::chrono::steady_clock::time_point deadline); // 멈추라는 요청이 오면 false
+  void emit(std::size_t i);
+
+  const GazeLogReader& reader_;
+  std::shared_ptr<Link> link_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+  std::atomic_bool running_{false};
+  std::thread thread_;
+
+  std::atomic<std::uint64_t> metrics_{0};
+  std::atomic<std::uint64_t> frames_{0};
+  std::atomic<std::int64_t> max_lag_us_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_REPLAYER_H_
@@ -0,0 +1,31 @@
+#ifndef EYEDID_CPP_SAMPLE_GAZE_SAMPLE_H_
+#define EYEDID_CPP_SAMPLE_GAZE_SAMPLE_H_
+
+#include <cstdint>
+
+#include "eyedid/gaze_tracker.h"
+
+namespace sample {
+
+/**
+ * 시선 상세 데이터 (on_gaze_sample_으로 전달)
+ * - 좌표는 창 기준 (on_gaze_와 같은 보정), 정수로 바꾸지 않음
+ */
+struct GazeSample {
+  std::uint64_t timestamp = 0;             // SDK 타임스탬프 (ms)
+  float x = 0.f;                           // 시선 x 좌표
+  float y = 0.f;                           // 시선 y 좌표
+  float fixation_x = 0.f;                  // 고정된 시선의 x 좌표
+  float fixation_y = 0.f;                  // 고정된 시선의 y 좌표
+  EyedidEyeMovementState movement_state{}; // 눈의 움직임 상태 (고정/도약)
+  bool valid = false;                      // 추적 성공 여부 (false이면 좌표는 0)
+
+  // 시선을 계산한 원본 프레임 (TrackerManager::addFrame(FrameEnvelope)로 넣은 프레임, 모르면 0)
+  std::uint64_t frame_sequence = 0;        // 소스별 프레임 번호
+  std::uint32_t source_id = 0;             // 프레임 소스 번호
+  std::int64_t capture_ns = 0;             // 캡처 시각 (steady_clock, ns)
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_GAZE_SAMPLE_H_
@@ -0,0 +1,276 @@
+#include "latency_trace.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace sample {
+
+constexpr std::size_t LatencyTracer::kBufferCapacity;
+constexpr int LatencyTracer::Histogram::kLinear;
+constexpr int LatencyTracer::Histogram::kSubBits;
+constexpr int LatencyTracer::Histogram::kBuckets;
+constexpr std::size_t LatencyTracer::SlotMap::kSize;
+constexpr std::uint64_t LatencyTracer::SlotMap::kBusy;
+
+namespace {
+
+// 현재 스레드 이름
+thread_local const char* thread_name_ = nullptr;
+
+// 값을 최댓값에 반영
+void update_max(std::atomic<std::int64_t>& max, std::int64_t value) {
+  auto current = max.load(std::memory_order_relaxed);
+  while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+} // namespace
+
+const char* trace_stage_name(TraceStage stage) {
+  switch (stage) {
+    case TraceStage::kCapture: return "capture";
+    case TraceStage::kSubmit:  return "submit";
+    case TraceStage::kMetrics: return "metrics";
+    case TraceStage::kGaze:    return "gaze";
+    case TraceStage::kPresent: return "present";
+    default:                   return "unknown";
+  }
+}
+
+// **Histogram 클래스**
+int LatencyTracer::Histogram::bucket_of(std::int64_t us) {
+  if (us < kLinear)
+    return us < 0 ? 0 : static_cast<int>(us);
+
+  int e = 63;
+  while ((static_cast<std::uint64_t>(us) >> e) == 0)
+    --e;
+  const int sub = static_cast<int>(us >> (e - kSubBits)) & ((1 << kSubBits) - 1);
+  return std::min(kLinear + (e - 4) * (1 << kSubBits) + sub, kBuckets - 1);
+}
+
+std::int64_t LatencyTracer::Histogram::value_of(int bucket) {
+  if (bucket < kLinear)
+    return bucket;
+  const int e = (bucket - kLinear) / (1 << kSubBits) + 4;
+  const int sub = (bucket - kLinear) % (1 << kSubBits);
+  const std::int64_t width = std::int64_t{1} << (e - kSubBits);
+  return ((1 << kSubBits) + sub) * width + width / 2;
+}
+
+void LatencyTracer::Histogram::add(std::int64_t us) {
+  buckets_[bucket_of(us)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  update_max(max_, us);
+}
+
+void LatencyTracer::Histogram::reset() {
+  for (auto& bucket : buckets_)
+    bucket.store(0, std::memory_order_relaxed);
+  count_.store(0, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+// 기록 중에 읽으면 칸별 값과 count_가 조금 어긋날 수 있으므로 칸의 합계를 기준으로 함
+std::int64_t LatencyTracer::Histogram::percentile(double q) const {
+  std::uint64_t counts[kBuckets];
+  std::uint64_t total = 0;
+  for (int b = 0; b < kBuckets; ++b) {
+    counts[b] = buckets_[b].load(std::memory_order_relaxed);
+    total += counts[b];
+  }
+  if (total == 0)
+    return 0;
+
+  const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(total - 1));
+  std::uint64_t seen = 0;
+  for (int b = 0; b < kBuckets; ++b) {
+    seen += counts[b];
+    if (seen > rank)
+      return std::min(value_of(b), max());
+  }
+  return max();
+}
+
+// **SlotMap 클래스**
+// - 쓰는 동안 key를 kBusy로 두어, 읽는 쪽이 쓰는 중인 칸의 값을 다른 키의 값으로 읽지 않게 함
+// - 다른 스레드가 같은 칸에 쓰는 중이면 기다리지 않고 버림 (지연 표본 하나를 잃을 뿐)
+void LatencyTracer::SlotMap::put(std::uint64_t key, std::uint64_t value) {
+  auto& slot = slots_[index(key)];
+  auto current = slot.key.load(std::memory_order_relaxed);
+  if ((current & kBusy) != 0 || !slot.key.compare_exchange_strong(current, kBusy, std::memory_order_relaxed))
+    return;
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.value.store(value, std::memory_order_relaxed);
+  slot.key.store(key, std::memory_order_release);
+}
+
+bool LatencyTracer::SlotMap::get(std::uint64_t key, std::uint64_t* value) const {
+  const auto& slot = slots_[index(key)];
+  if (slot.key.load(std::memory_order_acquire) != key)
+    return false;
+  *value = slot.value.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.key.load(std::memory_order_relaxed) == key;
+}
+
+// **LatencyTracer 클래스**
+LatencyTracer::LatencyTracer()
+: epoch_ns_(now_ns()) {}
+
+LatencyTracer& LatencyTracer::instance() {
+  static LatencyTracer tracer;
+  return tracer;
+}
+
+void LatencyTracer::record(TraceStage stage, std::uint64_t frame, std::int64_t begin_ns, std::int64_t end_ns) {
+  if (!enabled())
+    return;
+
+  const auto s = static_cast<std::size_t>(stage);
+  durations_[s].add((end_ns - begin_ns) / 1000);
+  if (frame != 0) {
+    std::uint64_t capture_ns;
+    if (captures_.get(frame, &capture_ns))
+      latencies_[s].add((end_ns - static_cast<std::int64_t>(capture_ns)) / 1000);
+    latest_[s].store(frame, std::memory_order_relaxed);
+  }
+
+  auto* buffer = thread_buffer();
+  const auto head = buffer->head.load(std::memory_order_relaxed);
+  if (head - buffer->tail.load(std::memory_order_acquire) >= kBufferCapacity) {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  auto& event = buffer->events[head % kBufferCapacity];
+  event.begin_ns = begin_ns;
+  event.end_ns = end_ns;
+  event.frame = frame;
+  event.stage = stage;
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void LatencyTracer::note_capture(std::uint64_t frame, std::int64_t capture_ns) {
+  if (frame != 0 && enabled())
+    captures_.put(frame, static_cast<std::uint64_t>(capture_ns));
+}
+
+void LatencyTracer::set_thread_name(const char* name) {
+  thread_name_ = name;
+}
+
+// 스레드의 첫 기록에서만 잠금과 할당이 있음
+// - 버퍼는 tracer와 함께 유지되므로 스레드가 끝난 뒤에도 남은 구간을 출력할 수 있음
+LatencyTracer::ThreadBuffer* LatencyTracer::thread_buffer() {
+  thread_local ThreadBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    std::unique_ptr<ThreadBuffer> created(new ThreadBuffer());
+    created->events.resize(kBufferCapacity);
+    std::lock_guard<std::mutex> lck(buffers_mutex_);
+    created->tid = static_cast<std::uint32_t>(buffers_.size() + 1);
+    buffers_.push_back(std::move(created));
+    buffer = buffers_.back().get();
+  }
+  if (buffer->name.load(std::memory_order_relaxed) != thread_name_)
+    buffer->name.store(thread_name_, std::memory_order_relaxed);
+  return buffer;
+}
+
+LatencyTracer::StageStats LatencyTracer::stats(TraceStage stage) const {
+  const auto s = static_cast<std::size_t>(stage);
+  StageStats stats;
+  stats.count = durations_[s].count();
+  stats.p50_us = durations_[s].percentile(0.50);
+  stats.p99_us = durations_[s].percentile(0.99);
+  stats.max_us = durations_[s].max();
+  stats.latency_count = latencies_[s].count();
+  stats.latency_p50_us = latencies_[s].percentile(0.50);
+  stats.latency_p99_us = latencies_[s].percentile(0.99);
+  stats.latency_max_us = latencies_[s].max();
+  return stats;
+}
+
+void LatencyTracer::reset_stats() {
+  for (auto& histogram : durations_)
+    histogram.reset();
+  for (auto& histogram : latencies_)
+    histogram.reset();
+}
+
+std::uint64_t LatencyTracer::dropped() const {
+  std::lock_guard<std::mutex> lck(buffers_mutex_);
+  std::uint64_t dropped = 0;
+  for (const auto& buffer : buffers_)
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  return dropped;
+}
+
+// 구간은 완료 이벤트("X"), 같은 프레임의 구간은 bind_id + flow_in/flow_out으로 연결
+std::size_t LatencyTracer::write_chrome_trace(std::ostream& out) {
+  std::lock_guard<std::mutex> lck(buffers_mutex_);
+  char line[256];
+  bool first = true;
+  std::size_t written = 0;
+
+  const auto emit = [&](const char* text) {
+    out << (first ? "\n" : ",\n") << text;
+    first = false;
+  };
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (const auto& buffer : buffers_) {
+    const char* name = buffer->name.load(std::memory_order_relaxed);
+    if (name != nullptr) {
+      std::snprintf(line, sizeof(line),
+                    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                    buffer->tid, name);
+      emit(line);
+    }
+
+    const auto head = buffer->head.load(std::memory_order_acquire);
+    auto tail = buffer->tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+      const auto& event = buffer->events[tail % kBufferCapacity];
+      const double ts = static_cast<double>(event.begin_ns - epoch_ns_) / 1000.0;
+      const double dur = static_cast<double>(event.end_ns - event.begin_ns) / 1000.0;
+      if (event.frame == 0) {
+        std::snprintf(line, sizeof(line),
+                      "{\"name\":\"%s\",\"cat\":\"latency\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                      trace_stage_name(event.stage), buffer->tid, ts, dur);
+      } else {
+        std::snprintf(line, sizeof(line),
+                      "{\"name\":\"%s\",\"cat\":\"latency\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+                      "\"bind_id\":\"%llu\",\"flow_in\":%s,\"flow_out\":%s,\"args\":{\"frame\":%llu}}",
+                      trace_stage_name(event.stage), buffer->tid, ts, dur,
+                      static_cast<unsigned long long>(event.frame),
+                      event.stage != TraceStage::kCapture ? "true" : "false",
+                      event.stage != TraceStage::kPresent ? "true" : "false",
+                      static_cast<unsigned long long>(event.frame));
+      }
+      emit(line);
+      ++written;
+    }
+    buffer->tail.store(tail, std::memory_order_release);
+  }
+  out << "\n]}\n";
+  return written;
+}
+
+void LatencyTracer::write_summary(std::ostream& out) const {
+  char line[160];
+  std::snprintf(line, sizeof(line), "%-8s %8s %9s %9s %9s | %9s %9s %9s\n",
+                "stage", "count", "p50(us)", "p99(us)", "max(us)", "lat p50", "lat p99", "lat max");
+  out << line;
+  for (std::size_t s = 0; s < static_cast<std::size_t>(TraceStage::kCount); ++s) {
+    const auto stage = static_cast<TraceStage>(s);
+    const auto st = stats(stage);
+    std::snprintf(line, sizeof(line), "%-8s %8llu %9lld %9lld %9lld | %9lld %9lld %9lld\n",
+                  trace_stage_name(stage), static_cast<unsigned long long>(st.count),
+                  static_cast<long long>(st.p50_us), static_cast<long long>(st.p99_us),
+                  static_cast<long long>(st.max_us), static_cast<long long>(st.latency_p50_us),
+                  static_cast<long long>(st.latency_p99_us), static_cast<long long>(st.latency_max_us));
+    out << line;
+  }
+  out << "dropped spans: " << dropped() << '\n';
+}
+
+} // namespace sample
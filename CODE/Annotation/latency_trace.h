@@ -0,0 +1,220 @@
+#ifndef EYEDID_CPP_SAMPLE_LATENCY_TRACE_H_
+#define EYEDID_CPP_SAMPLE_LATENCY_TRACE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace sample {
+
+// 지연을 측정하는 파이프라인 단계 (카메라 → 화면 순서)
+enum class TraceStage : std::uint8_t {
+  kCapture,  // 프레임 소스에서 프레임 읽기 (CameraThread)
+  kSubmit,   // RGB 변환 + addFrame (LatestFrameFeed)
+  kMetrics,  // SDK 추적 콜백 처리 (TrackerManager::OnMetrics)
+  kGaze,     // 시선 리스너 (GUI 스레드)
+  kPresent,  // 화면 출력 (View::drawWindow)
+  kCount,
+};
+
+const char* trace_stage_name(TraceStage stage);
+
+/**
+ * LatencyTracer 클래스:
+ * - 카메라 캡처부터 화면 출력까지 단계별 구간(span)을 기록하여 어디서 시간이 걸리는지 확인
+ * - 구간마다 프레임 번호를 붙여 같은 프레임이 거친 단계를 이어 봄
+ *   - 캡처 시각을 기준으로 각 단계가 끝날 때까지의 지연(캡처 후 지연)도 집계
+ *   - 프레임 번호는 FrameEnvelope::trace_id() (SDK 콜백까지 FrameEnvelope로 전달),
+ *     GUI 스레드의 단계는 앞 단계를 마지막으로 거친 프레임(latest_frame)을 사용
+ * - 기록: 스레드마다 고정 크기 버퍼에 잠금 없이 쌓음 (스레드의 첫 기록 때만 버퍼를 등록)
+ *   - 버퍼가 가득 차면 버리고 dropped()로 셈
+ *   - write_chrome_trace()로 쌓인 구간을 Chrome trace / Perfetto JSON으로 출력
+ * - 단계별 소요 시간과 캡처 후 지연은 로그 눈금 히스토그램으로 집계 (stats()의 p50/p99, 어느 스레드에서나 호출 가능)
+ * - 시각은 steady_clock, 비활성 상태(기본값)에서는 기록하지 않음 (구간마다 원자 변수 읽기 한 번)
+ * - 프로세스에 하나 (instance())
+ */
+class LatencyTracer {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  static constexpr std::size_t kBufferCapacity = 4096; // 스레드별 버퍼 크기 (구간 수)
+
+  // 단계별 지연 통계 (us)
+  struct StageStats {
+    std::uint64_t count = 0;           // 기록한 구간 수
+    std::int64_t p50_us = 0;           // 구간 소요 시간
+    std::int64_t p99_us = 0;
+    std::int64_t max_us = 0;
+    std::uint64_t latency_count = 0;   // 캡처 시각을 알고 있는 구간 수
+    std::int64_t latency_p50_us = 0;   // 캡처 → 구간 끝 지연
+    std::int64_t latency_p99_us = 0;
+    std::int64_t latency_max_us = 0;
+  };
+
+  static LatencyTracer& instance();
+
+  LatencyTracer(const LatencyTracer&) = delete;
+  LatencyTracer& operator=(const LatencyTracer&) = delete;
+
+  void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // 현재 시각 (steady_clock, ns)
+  static std::int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+  }
+
+  /**
+   * 구간 기록 (구간을 끝낸 스레드에서 호출, 보통 TraceSpan 사용)
+   * @param frame 프레임 번호 (0이면 프레임과 관계없는 구간)
+   */
+  void record(TraceStage stage, std::uint64_t frame, std::int64_t begin_ns, std::int64_t end_ns);
+
+  // 프레임의 캡처 시각 기록 (캡처 후 지연의 기준)
+  void note_capture(std::uint64_t frame, std::int64_t capture_ns);
+
+  // 해당 단계를 마지막으로 거친 프레임 번호 (없으면 0)
+  std::uint64_t latest_frame(TraceStage stage) const {
+    return latest_[static_cast<std::size_t>(stage)].load(std::memory_order_relaxed);
+  }
+
+  // 현재 스레드 이름 (trace 출력에 사용, 문자열 상수여야 함)
+  static void set_thread_name(const char* name);
+
+  StageStats stats(TraceStage stage) const;
+  void reset_stats(); // 히스토그램 초기화 (버퍼의 구간은 유지)
+
+  std::uint64_t dropped() const;
+
+  /**
+   * 버퍼에 쌓인 구간을 꺼내 Chrome trace / Perfetto JSON으로 출력
+   * - 같은 프레임의 구간은 흐름(flow) 화살표로 이어짐
+   * - 호출할 때마다 완전한 JSON 문서 하나를 씀 (이전 호출 이후의 구간)
+   * @return 출력한 구간 수
+   */
+  std::size_t write_chrome_trace(std::ostream& out);
+
+  // 단계별 통계 표 출력
+  void write_summary(std::ostream& out) const;
+
+ private:
+  // 로그 눈금 히스토그램 (us, 2배 구간마다 8칸, 오차 약 12%)
+  class Histogram {
+   public:
+    static constexpr int kLinear = 16;
+    static constexpr int kSubBits = 3;
+    static constexpr int kBuckets = kLinear + (40 - 4) * (1 << kSubBits);
+
+    void add(std::int64_t us);
+    void reset();
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    std::int64_t max() const { return max_.load(std::memory_order_relaxed); }
+    std::int64_t percentile(double q) const;
+
+   private:
+    static int bucket_of(std::int64_t us);
+    static std::int64_t value_of(int bucket); // 칸의 중앙값
+
+    std::atomic<std::uint64_t> buckets_[kBuckets] = {};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::int64_t> max_{0};
+  };
+
+  // 키 → 값 고정 크기 표 (키가 같은 칸에 겹치면 덮어씀, 잠금 없이 여러 스레드에서 쓰고 읽음)
+  class SlotMap {
+   public:
+    static constexpr std::size_t kSize = 1024;
+    static constexpr std::uint64_t kBusy = std::uint64_t{1} << 63; // 쓰는 중 (키는 이 비트를 쓰지 않아야 함)
+
+    void put(std::uint64_t key, std::uint64_t value);
+    bool get(std::uint64_t key, std::uint64_t* value) const;
+
+   private:
+    struct Slot {
+      std::atomic<std::uint64_t> key{0}; // 0이면 비어 있음, kBusy면 쓰는 중
+      std::atomic<std::uint64_t> value{0};
+    };
+    static std::size_t index(std::uint64_t key) {
+      return static_cast<std::size_t>((key ^ (key >> 48) * 0x9E3779B1u) % kSize); // 소스 번호(상위 비트)도 칸에 반영
+    }
+
+    Slot slots_[kSize];
+  };
+
+  struct Event {
+    std::int64_t begin_ns = 0;
+    std::int64_t end_ns = 0;
+    std::uint64_t frame = 0;
+    TraceStage stage = TraceStage::kCapture;
+  };
+
+  // 스레드별 버퍼 (기록하는 스레드 하나 → write_chrome_trace 하나)
+  struct ThreadBuffer {
+    std::uint32_t tid = 0;
+    std::atomic<const char*> name{nullptr}; // set_thread_name()으로 지정한 이름
+    std::vector<Event> events;
+    std::atomic<std::uint64_t> head{0}; // 다음에 쓸 위치 (기록 스레드)
+    std::atomic<std::uint64_t> tail{0}; // 다음에 읽을 위치 (출력 스레드)
+    std::atomic<std::uint64_t> dropped{0};
+  };
+
+  LatencyTracer();
+
+  ThreadBuffer* thread_buffer(); // 현재 스레드의 버퍼 (처음이면 등록)
+
+  std::atomic_bool enabled_{false};
+  const std::int64_t epoch_ns_;   // trace 출력의 시각 기준
+
+  Histogram durations_[static_cast<std::size_t>(TraceStage::kCount)];
+  Histogram latencies_[static_cast<std::size_t>(TraceStage::kCount)];
+  std::atomic<std::uint64_t> latest_[static_cast<std::size_t>(TraceStage::kCount)] = {};
+
+  SlotMap captures_; // 프레임 번호 → 캡처 시각 (ns)
+
+  mutable std::mutex buffers_mutex_; // 버퍼 등록/출력
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+};
+
+/**
+ * TraceSpan 클래스:
+ * - 생성부터 end() 또는 소멸까지를 한 구간으로 기록
+ * - 추적이 비활성 상태면 시각도 읽지 않음
+ */
+class TraceSpan {
+ public:
+  explicit TraceSpan(TraceStage stage, std::uint64_t frame = 0)
+  : stage_(stage), frame_(frame),
+    begin_ns_(LatencyTracer::instance().enabled() ? LatencyTracer::now_ns() : 0) {}
+
+  ~TraceSpan() { end(); }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+  void set_frame(std::uint64_t frame) { frame_ = frame; }
+
+  // 구간을 끝내고 기록 (한 번만 기록)
+  void end() {
+    if (begin_ns_ == 0)
+      return;
+    LatencyTracer::instance().record(stage_, frame_, begin_ns_, LatencyTracer::now_ns());
+    begin_ns_ = 0;
+  }
+
+  // 기록하지 않고 버림
+  void cancel() { begin_ns_ = 0; }
+
+ private:
+  TraceStage stage_;
+  std::uint64_t frame_;
+  std::int64_t begin_ns_; // 0이면 기록하지 않음
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_LATENCY_TRACE_H_
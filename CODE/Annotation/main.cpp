@@ -1,3 +1,5 @@
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <thread>
 #include <stdexcept>
@@ -11,6 +13,12 @@
 #include "tracker_manager.h" // 추적 관리자 관련 클래스
 #include "view.h"            // GUI를 그리기 위한 클래스
 #include "camera_thread.h"   // 카메라 스레드 구현 관련 클래스
+#include "capture_manager.h" // 카메라별 캡처 → SDK 전달 파이프라인
+#include "executor.h"        // 리스너를 GUI 스레드에서 실행하는 실행기
+#include "frame_pool.h"      // 화면 미리보기 프레임 버퍼 재사용
+#include "frame_clock.h"     // 그리기 루프 주기
+#include "gaze_heatmap.h"    // 시선 히트맵
+#include "latency_trace.h"   // 단계별 지연 추적
 
 #ifdef EYEDID_TEST_KEY
 #  define EYEDID_STRINGFY_IMPL(x) #x
@@ -42,9 +50,22 @@ int main() {
   }
   printDisplays(displays); // 디스플레이 정보 출력
 
+  // GUI 스레드(아래의 그리기 루프)에서 시그널 슬롯을 실행하는 실행기
+  // - 시그널을 발행하는 TrackerManager보다 먼저 생성하여 더 오래 유지되도록 함
+  sample::LoopExecutor ui_executor;
+
+  const auto& main_display = displays[0]; // 메인 디스플레이 선택
+  const cv::Size window_size(main_display.widthPx * 2 / 3, main_display.heightPx * 2 / 3); // GUI 창 크기
+
+  // 시선 히트맵 ('H' 키로 표시/숨김)
+  // - on_gaze_sample_은 SDK 콜백 스레드에서 발행되므로, 시그널을 발행하는 TrackerManager와
+  //   프레임을 넣는 카메라(capture)보다 먼저 생성하여 그 스레드들이 멈춘 뒤에 소멸되도록 함
+  sample::GazeHeatmap::Options heatmap_options;
+  heatmap_options.screen = window_size;
+  sample::GazeHeatmap heatmap(heatmap_options);
+
   // Gaze Tracker 관리자 생성
   auto tracker_manager = std::make_shared<sample::TrackerManager>();
-  auto tracker_manager_ptr = tracker_manager.get();
 
   // 추가 기능(사용자 상태 및 깜박임 감지) 옵션 설정
   EyedidTrackerOptions options;
@@ -56,8 +77,11 @@ int main() {
   if (!code)
     return EXIT_FAILURE; // 초기화 실패 시 프로그램 종료
 
+  // 얼굴/눈 깜박임/주의/졸음 데이터를 콘솔에 출력 (SDK 추적 스레드가 아닌 기록 스레드에서 출력)
+  // - 파일로 기록하려면 sample::BinaryFileTelemetrySink를 사용
+  tracker_manager->telemetry().start(std::unique_ptr<sample::TelemetrySink>(new sample::TextTelemetrySink(std::cout)));
+
   // 카메라 좌표계를 디스플레이 픽셀 단위로 변환
-  const auto& main_display = displays[0]; // 메인 디스플레이 선택
   tracker_manager->setDefaultCameraToDisplayConverter(main_display);
 
   // 전체 화면을 사용자의 관심 영역(ROI)으로 설정
@@ -65,90 +89,170 @@ int main() {
     tracker_manager->setWholeScreenToAttentionRegion(main_display);
   }
 
-  // 카메라를 별도의 스레드에서 실행
+  // 카메라를 별도의 스레드에서 실행하고 Eyedid SDK에 프레임 전달
+  // - SDK가 밀리면 오래된 프레임은 버리고 가장 최신 프레임만 전달하여 시선 지연이 쌓이지 않게 함
+  // - 캡처 시각과 프레임 번호가 SDK 결과(GazeSample)까지 전달됨
+  // - 카메라 없이 시험하려면 프레임 소스를 지정 (예: 640x480 240fps 합성 프레임)
+  //   capture.add(std::unique_ptr<sample::FrameSource>(new sample::SyntheticFrameSource({640, 480}, 240)), tracker_manager);
+  // - 여러 좌석을 한 프로세스에서 처리하려면 카메라마다 TrackerManager를 만들어 add_camera()를 반복
+  //   (파이프라인마다 다른 코어에서 실행, 캡처 시각 정렬은 Options::align)
   int camera_index = 0;
-  sample::CameraThread camera_thread;
-  if (!camera_thread.run(camera_index))
+  sample::CaptureManager capture;
+  capture.add_camera(camera_index, tracker_manager);
+  if (!capture.start())
     return EXIT_FAILURE; // 카메라 실행 실패 시 프로그램 종료
 
   // GUI를 그릴 창 생성
+  // - 창 없이(서버/CI) 실행하려면 출력 방식을 지정 (예: 그린 화면을 버림)
+  //   std::unique_ptr<sample::ViewBackend>(new sample::HeadlessViewBackend()) 를 네 번째 인자로 전달
   const char* window_name = "eyedid-sample";
-  auto view = std::make_shared<sample::View>(
-      main_display.widthPx * 2 / 3, main_display.heightPx * 2 / 3, window_name);
+  auto view = std::make_shared<sample::View>(window_size.width, window_size.height, window_name);
   auto view_ptr = view.get();
   tracker_manager->window_name_ = window_name;
+  tracker_manager->window_geometry().refresh(window_name); // 시선 좌표 보정에 쓸 창 위치
+
+  // 그리기 루프 주기 (10ms, waitKey 대기 시간 대신 사용)
+  // - 벤치마크에서 최대 속도로 돌리려면 sample::FrameClock::Mode::kUnpaced
+  sample::FrameClock frame_clock(std::chrono::milliseconds(10));
+
+  // 시선 점의 떨림을 줄이고 캡처~표시 지연만큼 앞을 예측 (One Euro 평활화 + 등속 예측)
+  // - 예측 시간은 시선마다 (지금 - 캡처 시각) + 그리기 루프의 예상 표시 지연
+  // - 평활화만: make_gaze_filter(sample::OneEuroFilter()), 칼만: make_gaze_filter(sample::KalmanFilter())
+  sample::ConstantVelocityPredictor<> gaze_filter;
+  gaze_filter.present_delay_ms = static_cast<float>(frame_clock.present_delay().count()) * 1e-3f;
+  tracker_manager->setGazeFilter(sample::make_gaze_filter(gaze_filter));
 
   /// 이벤트 리스너 추가
+  // - 리스너는 SDK 추적 스레드가 아닌 GUI 스레드(ui_executor)에서 실행되므로 추적 지연에 영향을 주지 않음
+  // - 화면 요소는 View::update()로 변경하며, draw()는 잠금 없이 최신 스냅샷을 그림
   // 1. 사용자의 시선 위치 표시
   tracker_manager->on_gaze_.connect([=](int x, int y, bool valid) {
-    sample::write_lock_guard lock(view_ptr->write_mutex());
-    if (valid) {
-      view_ptr->gaze_point_.center = {x, y};
-      view_ptr->gaze_point_.color = {0, 220, 220}; // 유효한 시선: 청록색
-    } else {
-      view_ptr->gaze_point_.color = {0, 0, 220};   // 유효하지 않은 시선: 빨간색
-    }
-    view_ptr->gaze_point_.visible = true;
-  }, view);
+    sample::TraceSpan span(sample::TraceStage::kGaze,
+                           sample::LatencyTracer::instance().latest_frame(sample::TraceStage::kMetrics));
+    view_ptr->update([=](sample::ViewState& state) {
+      if (valid) {
+        state.gaze_point.center = {x, y};
+        state.gaze_point.color = {0, 220, 220}; // 유효한 시선: 청록색
+      } else {
+        state.gaze_point.color = {0, 0, 220};   // 유효하지 않은 시선: 빨간색
+      }
+      state.gaze_point.visible = true;
+    });
+  }, view, ui_executor, sample::queue_policy::kLatest); // 마지막 시선 위치만 의미가 있음
 
   // 2. 캘리브레이션 중 UI 상태 변경
   tracker_manager->on_calib_start_.connect([=]() {
-    sample::write_lock_guard lock(view_ptr->write_mutex());
-    view_ptr->calibration_desc_.visible = true; // 캘리브레이션 설명 표시
-    for (auto& desc : view_ptr->desc_)
-      desc.visible = false; // 다른 설명 숨기기
-    view_ptr->frame_.visible = false; // 카메라 프레임 숨기기
-  }, view);
+    view_ptr->update([](sample::ViewState& state) {
+      state.calibration_desc.visible = true; // 캘리브레이션 설명 표시
+      for (auto& desc : state.desc.write())
+        desc.visible = false; // 다른 설명 숨기기
+      state.frame.visible = false; // 카메라 프레임 숨기기
+    });
+  }, view, ui_executor);
 
   tracker_manager->on_calib_finish_.connect([=](const std::vector<float>& data) {
-    sample::write_lock_guard lock(view_ptr->write_mutex());
-    view_ptr->calibration_desc_.visible = false;
-    view_ptr->calibration_point_.visible = false;
-    for (auto& desc : view_ptr->desc_)
-      desc.visible = true; // 설명 다시 표시
-    view_ptr->frame_.visible = true; // 카메라 프레임 다시 표시
-  }, view);
+    view_ptr->update([](sample::ViewState& state) {
+      state.calibration_desc.visible = false;
+      state.calibration_point.visible = false;
+      for (auto& desc : state.desc.write())
+        desc.visible = true; // 설명 다시 표시
+      state.frame.visible = true; // 카메라 프레임 다시 표시
+    });
+  }, view, ui_executor);
 
   // 3. 캘리브레이션 다음 지점 표시
   tracker_manager->on_calib_next_point_.connect([=](int x, int y) {
-    sample::write_lock_guard lock(view_ptr->write_mutex());
-    view_ptr->calibration_point_.center = {x, y};
-    view_ptr->calibration_point_.visible = true;
-    view_ptr->calibration_desc_.visible = false;
-  }, view);
+    view_ptr->update([=](sample::ViewState& state) {
+      state.calibration_point.center = {x, y};
+      state.calibration_point.visible = true;
+      state.calibration_desc.visible = false;
+    });
+  }, view, ui_executor);
 
   tracker_manager->on_calib_progress_.connect([=](float progress) {
     std::cout << '\r' << progress * 100 << '%'; // 진행률 표시
-  }, view);
-
-  /// 카메라 프레임 리스너 추가
-  // 1. 프레임을 GUI에 그리기
-  camera_thread.on_frame_.connect([=](const cv::Mat& frame) {
-    sample::write_lock_guard lock(view_ptr->write_mutex());
-    cv::resize(frame, view_ptr->frame_.buffer, {640, 480});
-  }, view);
-
-  // 2. Eyedid SDK에 프레임 전달
-  camera_thread.on_frame_.connect([=](const cv::Mat& frame) {
-    static auto cvt = new cv::Mat();
-    static const auto current_time = [] {
-      using clock = std::chrono::steady_clock;
-      return std::chrono::duration_cast<std::chrono::milliseconds>(clock::now().time_since_epoch()).count();
-    };
-    cv::cvtColor(frame, *cvt, cv::COLOR_BGR2RGB); // 프레임을 RGB로 변환
-    tracker_manager_ptr->addFrame(current_time(), *cvt); // SDK에 전달
-  }, tracker_manager);
+  }, view, ui_executor, sample::queue_policy::kLatest);
+
+  /// 카메라 프레임 소비자 추가
+  // - 각 소비자는 별도의 스레드에서 실행되므로 느린 소비자가 카메라 캡처 속도를 떨어뜨리지 않음
+  // 1. 프레임을 GUI에 그리기 (항상 최신 프레임만 표시)
+  // - 스냅샷과 부분 갱신용 이전 상태가 이전 프레임 버퍼를 참조하고 있을 수 있으므로 풀에서 비어 있는 버퍼에 크기 조정
+  // - 화면에 표시되는 크기로 한 번만 크기 조정하고 버전을 올리면, 그리는 쪽은 새 프레임일 때만 복사함
+  sample::FramePool preview_pool(8);
+  const cv::Size preview_size = view->frameSize();
+  sample::FrameConsumerThread preview_consumer(
+      capture.camera(0).frame_ring(), "preview", sample::FrameRing::DropPolicy::kLatestOnly,
+      [=, &preview_pool, version = std::uint64_t{0}](const cv::Mat& frame) mutable {
+        cv::Mat* buffer = preview_pool.acquire();
+        if (buffer == nullptr)
+          return; // 모든 버퍼가 화면 스냅샷에서 사용 중
+        cv::resize(frame, *buffer, preview_size);
+        preview_pool.commit(buffer);
+        const auto frame_version = ++version;
+        view_ptr->update([=](sample::ViewState& state) {
+          state.frame.buffer = *buffer;
+          state.frame.version = frame_version;
+        });
+      });
+
+  // 2. 시선 히트맵 연결 (heatmap은 TrackerManager보다 먼저 생성)
+  // - SDK 콜백 스레드에서는 큐에 넣기만 하고, 누적과 그리기는 GUI 스레드(아래 루프)에서 수행
+  // - 격자 크기로 그린 뒤 drawables::Overlay가 창 크기로 늘려 반투명하게 그림
+  heatmap.attach(*tracker_manager);
+  sample::FramePool heatmap_pool(4);
+  sample::drawables::Scene::handle heatmap_handle;
+  std::uint64_t heatmap_version = 0;
+  bool heatmap_visible = false;
+  view->update([&](sample::ViewState& state) {
+    sample::drawables::Overlay overlay;
+    overlay.size = window_size;
+    overlay.visible = false;
+    heatmap_handle = state.scene.write().add(overlay);
+  });
+
+  // 카메라 캡처 → 화면 출력 단계별 지연 추적 ('T' 키로 통계 출력 및 trace 파일 저장)
+  // - latency_trace.json은 chrome://tracing 또는 https://ui.perfetto.dev 에서 열 수 있음
+  sample::LatencyTracer::set_thread_name("gui");
+  sample::LatencyTracer::instance().set_enabled(true);
+
+  frame_clock.reset(); // 창과 리스너를 준비하는 동안 지난 시간은 주기에서 제외
 
   // ESC 키 또는 'C' 키를 눌러 프로그램 제어
   while (true) {
-    int key = view->draw(10); // 10ms 간격으로 화면 갱신
+    ui_executor.run_pending(); // 리스너 실행
+    tracker_manager->window_geometry().refresh(window_name); // 창을 옮겼으면 위치 갱신 (주기 제한)
+    heatmap.update(); // 쌓인 시선을 히트맵에 반영
+    if (heatmap_visible) {
+      cv::Mat* buffer = heatmap_pool.acquire();
+      if (buffer != nullptr && heatmap.render(buffer)) { // 바뀐 것이 없으면 그리지 않음
+        heatmap_pool.commit(buffer);
+        const auto version = ++heatmap_version;
+        view->update([&](sample::ViewState& state) {
+          auto overlay = state.scene.write().get<sample::drawables::Overlay>(heatmap_handle);
+          overlay->buffer = *buffer;
+          overlay->version = version;
+        });
+      }
+    }
+    int key = view->draw(0); // 화면 갱신 (키 입력은 기다리지 않음)
     if (key == 27 /* ESC */) {
       break; // ESC 키로 종료
     } else if (key == 'c' || key == 'C') {
       tracker_manager->startFullWindowCalibration(
           kEyedidCalibrationPointFive,
           kEyedidCalibrationAccuracyDefault); // 캘리브레이션 시작
+    } else if (key == 'h' || key == 'H') {
+      heatmap_visible = !heatmap_visible;
+      view->update([&](sample::ViewState& state) {
+        state.scene.write().get<sample::drawables::Overlay>(heatmap_handle)->visible = heatmap_visible;
+      });
+    } else if (key == 't' || key == 'T') {
+      auto& tracer = sample::LatencyTracer::instance();
+      tracer.write_summary(std::cout);
+      std::ofstream trace_file("latency_trace.json", std::ios::trunc);
+      tracer.write_chrome_trace(trace_file); // 지난번 저장 이후의 구간
     }
+    frame_clock.wait(); // 다음 주기까지 대기
   }
   view->closeWindow(); // 창 닫기
 
@@ -0,0 +1,92 @@
+#ifndef EYEDID_CPP_SAMPLE_MPSC_QUEUE_H_
+#define EYEDID_CPP_SAMPLE_MPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace sample {
+
+/**
+ * MpscQueue 클래스:
+ * - 생산자 여럿, 소비자 하나인 고정 크기 큐 (각 칸에 순번을 두는 방식)
+ * - try_push()는 잠금 없이 동작하며, 큐가 가득 차면 대기하지 않고 false를 반환
+ * - try_pop()은 한 스레드(또는 한 번에 하나의 작업)에서만 호출해야 함
+ * - 용량은 2의 거듭제곱으로 올림
+ *
+ * @tparam T 저장할 값 타입 (기본 생성 및 이동 가능해야 함)
+ */
+template<typename T>
+class MpscQueue {
+ public:
+  explicit MpscQueue(std::size_t capacity) {
+    std::size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+    mask_ = size - 1;
+    cells_.reset(new Cell[size]);
+    for (std::size_t i = 0; i < size; ++i)
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  /**
+   * 값 추가 (생산자)
+   * @return 큐가 가득 차서 추가하지 못했으면 false
+   */
+  bool try_push(T&& value) {
+    auto pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = cells_[pos & mask_];
+      const auto seq = cell.seq.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = std::move(value);
+          cell.seq.store(pos + 1, std::memory_order_release); // 소비자에게 공개
+          return true;
+        }
+      } else if (diff < 0) {
+        return false; // 한 바퀴 전의 값이 아직 소비되지 않음
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * 값 꺼내기 (소비자)
+   * @return 꺼낼 값이 없거나 다음 칸을 생산자가 아직 채우는 중이면 false
+   */
+  bool try_pop(T* value) {
+    Cell& cell = cells_[head_ & mask_];
+    if (cell.seq.load(std::memory_order_acquire) != head_ + 1)
+      return false;
+
+    *value = std::move(cell.value);
+    cell.value = T(); // 값이 잡고 있던 자원을 바로 해제
+    cell.seq.store(head_ + mask_ + 1, std::memory_order_release); // 다음 바퀴의 생산자에게 반환
+    ++head_;
+    return true;
+  }
+
+  std::size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct Cell {
+    std::atomic_size_t seq; // 칸 순번 (pos: 비어 있음, pos + 1: 값이 있음)
+    T value;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  std::size_t mask_ = 0;
+  std::atomic_size_t tail_{0}; // 다음에 쓸 위치 (생산자 공유)
+  std::size_t head_ = 0;       // 다음에 읽을 위치 (소비자 전용)
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_MPSC_QUEUE_H_
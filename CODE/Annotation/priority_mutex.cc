@@ -1,86 +1,89 @@
 #include "priority_mutex.h"
 
+#include <algorithm>
+
 namespace sample {
 
-// **HighMutex 클래스**
-// 높은 우선순위의 잠금(mutex)을 관리하는 클래스입니다.
-void PriorityMutex::HighMutex::lock() {
-  // 높은 우선순위로 mutex를 잠급니다.
-  return m_.lock_high();
-}
+constexpr int PriorityMutex::LatencyHistogram::kBuckets;
+constexpr int PriorityMutex::kDefaultMaxConsecutiveHigh;
 
-void PriorityMutex::HighMutex::unlock() {
-  // 높은 우선순위의 mutex 잠금을 해제합니다.
-  return m_.unlock_high();
-}
+// **LatencyHistogram**
+std::int64_t PriorityMutex::LatencyHistogram::percentile_us(double percentile) const {
+  if (acquisitions == 0)
+    return 0;
 
-bool PriorityMutex::HighMutex::try_to_lock() {
-  // 높은 우선순위로 mutex를 시도하여 잠급니다.
-  return m_.try_to_lock_high();
+  const auto target = static_cast<std::uint64_t>(percentile * acquisitions + 0.5);
+  std::uint64_t accumulated = 0;
+  for (int i = 0; i < kBuckets; ++i) {
+    accumulated += counts[i];
+    if (accumulated >= target && accumulated != 0)
+      return i == kBuckets - 1 ? max_wait_us : (std::int64_t{1} << i); // 구간 상한
+  }
+  return max_wait_us;
 }
 
-// **LowMutex 클래스**
-// 낮은 우선순위의 잠금(mutex)을 관리하는 클래스입니다.
-void PriorityMutex::LowMutex::lock() {
-  // 낮은 우선순위로 mutex를 잠급니다.
-  m_.lock_low();
+// **AtomicHistogram**
+// 대기 시간을 log2(us) 구간에 기록합니다.
+void PriorityMutex::AtomicHistogram::record(clock_type::duration wait) {
+  const auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(wait).count();
+
+  int bucket = 0;
+  for (auto v = wait_us; v > 0 && bucket < LatencyHistogram::kBuckets - 1; v >>= 1)
+    ++bucket;
+
+  counts[bucket].fetch_add(1, std::memory_order_relaxed);
+  acquisitions.fetch_add(1, std::memory_order_relaxed);
+  total_wait_us.fetch_add(wait_us, std::memory_order_relaxed);
+  auto max = max_wait_us.load(std::memory_order_relaxed);
+  while (max < wait_us &&
+         !max_wait_us.compare_exchange_weak(max, wait_us, std::memory_order_relaxed)) {}
 }
 
-void PriorityMutex::LowMutex::unlock() {
-  // 낮은 우선순위의 mutex 잠금을 해제합니다.
-  m_.unlock_low();
+void PriorityMutex::AtomicHistogram::load(LatencyHistogram* out) const {
+  for (int i = 0; i < LatencyHistogram::kBuckets; ++i)
+    out->counts[i] = counts[i].load(std::memory_order_relaxed);
+  out->acquisitions = acquisitions.load(std::memory_order_relaxed);
+  out->timeouts = timeouts.load(std::memory_order_relaxed);
+  out->total_wait_us = total_wait_us.load(std::memory_order_relaxed);
+  out->max_wait_us = max_wait_us.load(std::memory_order_relaxed);
 }
 
-bool PriorityMutex::LowMutex::try_to_lock() {
-  // 낮은 우선순위로 mutex를 시도하여 잠급니다.
-  return m_.try_to_lock_low();
+void PriorityMutex::AtomicHistogram::reset() {
+  for (auto& count : counts)
+    count.store(0, std::memory_order_relaxed);
+  acquisitions.store(0, std::memory_order_relaxed);
+  timeouts.store(0, std::memory_order_relaxed);
+  total_wait_us.store(0, std::memory_order_relaxed);
+  max_wait_us.store(0, std::memory_order_relaxed);
 }
 
 // **PriorityMutex 클래스**
 // 높은 우선순위와 낮은 우선순위를 구분하여 mutex를 제어하는 클래스입니다.
+PriorityMutex::PriorityMutex(int max_consecutive_high)
+: max_consecutive_high_(std::max(1, max_consecutive_high)) {}
+
 void PriorityMutex::lock_low() {
-  // 낮은 우선순위로 잠금을 시도합니다.
-  // 만약 높은 우선순위의 작업이 진행 중이라면, 조건 변수를 사용하여 대기합니다.
-  std::unique_lock<mutex_type> lck(m_);
-  cv_.wait(lck, [this]{
-    // 높은 우선순위 작업이 없을 때만 진행
-    return !high_accessing_;
-  });
-  lck.release(); // 잠금을 해제합니다.
+  lock_impl(Priority::kLow, nullptr);
 }
 
 void PriorityMutex::unlock_low() {
-  // 낮은 우선순위 잠금을 해제하고 조건 변수를 알립니다.
-  m_.unlock();
-  cv_.notify_one();
+  unlock_impl();
 }
 
-bool PriorityMutex::try_to_lock_low() {
-  // 높은 우선순위 작업이 없고, mutex를 잠글 수 있으면 true를 반환합니다.
-  return !high_accessing_ && m_.try_lock();
+bool PriorityMutex::try_lock_low() {
+  return try_lock_impl(Priority::kLow);
 }
 
 void PriorityMutex::lock_high() {
-  // 높은 우선순위로 잠금을 시도하며, 이 작업이 진행 중임을 표시합니다.
-  ++high_accessing_;
-  m_.lock();
-  --high_accessing_; // 작업이 끝난 후 high_accessing_을 감소시킵니다.
+  lock_impl(Priority::kHigh, nullptr);
 }
 
 void PriorityMutex::unlock_high() {
-  // 높은 우선순위 잠금을 해제하고 조건 변수를 알립니다.
-  m_.unlock();
-  cv_.notify_one();
+  unlock_impl();
 }
 
-bool PriorityMutex::try_to_lock_high() {
-  // 높은 우선순위로 잠금을 시도합니다.
-  ++high_accessing_;
-  if (m_.try_lock()) {
-    --high_accessing_; // 잠금 성공 시 high_accessing_을 감소시킵니다.
-    return true;
-  }
-  return false; // 잠금 실패 시 false를 반환합니다.
+bool PriorityMutex::try_lock_high() {
+  return try_lock_impl(Priority::kHigh);
 }
 
 PriorityMutex::HighMutex& PriorityMutex::high() {
@@ -93,4 +96,118 @@ PriorityMutex::LowMutex& PriorityMutex::low() {
   return low_;
 }
 
+void PriorityMutex::set_max_consecutive_high(int count) {
+  std::lock_guard<mutex_type> lck(state_mutex_);
+  max_consecutive_high_ = std::max(1, count);
+  if (!locked_)
+    notify_next(); // 한도가 줄어 낮은 우선순위가 바로 잠글 수 있게 되었을 수 있음
+}
+
+int PriorityMutex::max_consecutive_high() const {
+  std::lock_guard<mutex_type> lck(state_mutex_);
+  return max_consecutive_high_;
+}
+
+PriorityMutex::Stats PriorityMutex::stats() const {
+  Stats stats;
+  high_stats_.load(&stats.high);
+  low_stats_.load(&stats.low);
+  stats.starvation_grants = starvation_grants_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void PriorityMutex::reset_stats() {
+  high_stats_.reset();
+  low_stats_.reset();
+  starvation_grants_.store(0, std::memory_order_relaxed);
+}
+
+// 잠금 획득
+// - 지금 잠글 수 있으면 바로 잠그고, 아니면 우선순위별 조건 변수에서 대기
+// - 시간이 초과되어 포기하면, 이 대기자 때문에 막혀 있던 다른 우선순위를 깨움
+bool PriorityMutex::lock_impl(Priority priority, const clock_type::time_point* deadline) {
+  const auto start = clock_type::now();
+  auto& stats = histogram(priority);
+  auto& cv = priority == Priority::kHigh ? high_cv_ : low_cv_;
+  auto& waiting = priority == Priority::kHigh ? high_waiting_ : low_waiting_;
+
+  std::unique_lock<mutex_type> lck(state_mutex_);
+  if (!can_acquire(priority)) {
+    ++waiting;
+    const auto ready = [this, priority]() { return can_acquire(priority); };
+    bool acquired = true;
+    if (deadline == nullptr)
+      cv.wait(lck, ready);
+    else
+      acquired = cv.wait_until(lck, *deadline, ready);
+    --waiting;
+
+    if (!acquired) {
+      if (!locked_)
+        notify_next();
+      lck.unlock();
+      stats.timeouts.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  acquire(priority);
+  lck.unlock();
+  stats.record(clock_type::now() - start);
+  return true;
+}
+
+bool PriorityMutex::try_lock_impl(Priority priority) {
+  {
+    std::lock_guard<mutex_type> lck(state_mutex_);
+    if (can_acquire(priority)) {
+      acquire(priority);
+      histogram(priority).record(clock_type::duration::zero());
+      return true;
+    }
+  }
+  histogram(priority).timeouts.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void PriorityMutex::unlock_impl() {
+  std::lock_guard<mutex_type> lck(state_mutex_);
+  locked_ = false;
+  notify_next();
+}
+
+// 잠금 가능 조건
+// - 높은 우선순위: 낮은 우선순위 대기자가 없거나 연속 잠금 횟수가 한도보다 작을 때
+// - 낮은 우선순위: 높은 우선순위 대기자가 없거나 연속 잠금 횟수가 한도에 도달했을 때
+bool PriorityMutex::can_acquire(Priority priority) const {
+  if (locked_)
+    return false;
+  const bool starving = consecutive_high_ >= max_consecutive_high_;
+  if (priority == Priority::kHigh)
+    return low_waiting_ == 0 || !starving;
+  return high_waiting_ == 0 || starving;
+}
+
+void PriorityMutex::acquire(Priority priority) {
+  locked_ = true;
+  if (priority == Priority::kLow) {
+    if (high_waiting_ != 0 && consecutive_high_ >= max_consecutive_high_)
+      starvation_grants_.fetch_add(1, std::memory_order_relaxed);
+    consecutive_high_ = 0;
+  } else if (low_waiting_ != 0) {
+    ++consecutive_high_;
+  } else {
+    consecutive_high_ = 0; // 기다리는 낮은 우선순위 작업이 없으면 연속 횟수를 세지 않음
+  }
+}
+
+// 잠금 해제 시 다음 대기자 선택
+// - 조건을 만족하는 우선순위의 대기자 하나만 깨움
+void PriorityMutex::notify_next() {
+  if (high_waiting_ != 0 && can_acquire(Priority::kHigh))
+    high_cv_.notify_one();
+  else if (low_waiting_ != 0 && can_acquire(Priority::kLow))
+    low_cv_.notify_one();
+}
+
 } // namespace sample
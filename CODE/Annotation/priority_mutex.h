@@ -1,54 +1,87 @@
 #ifndef EYEDID_CPP_SAMPLE_PRIORITY_MUTEX_H_
 #define EYEDID_CPP_SAMPLE_PRIORITY_MUTEX_H_
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
 namespace sample {
 
 // PriorityMutex 클래스
 // 높은 우선순위와 낮은 우선순위를 구분하여 mutex 잠금을 관리합니다.
+// - 잠금이 풀리면 대기 중인 높은 우선순위 작업이 먼저 잠금을 얻습니다.
+// - 낮은 우선순위 작업이 대기하는 동안 높은 우선순위 작업이 연속으로 max_consecutive_high()번
+//   잠금을 얻으면 다음 잠금은 낮은 우선순위 작업에게 넘어갑니다. (낮은 우선순위 기아 방지)
+// - HighMutex/LowMutex는 std::lock_guard, std::unique_lock과 함께 쓸 수 있으며
+//   try_lock_for/try_lock_until을 지원합니다. (TimedLockable)
+// - 우선순위별 잠금 획득 대기 시간을 히스토그램으로 기록합니다.
 class PriorityMutex {
-  // HighMutex 클래스
-  // 높은 우선순위의 mutex 잠금을 관리하는 내부 클래스입니다.
-  class HighMutex {
-   public:
-    // 생성자
-    // PriorityMutex 객체를 참조로 받아 초기화합니다.
-    explicit HighMutex(PriorityMutex& m) noexcept : m_(m) {}
+ public:
+  using clock_type = std::chrono::steady_clock;
+
+  // 잠금 획득 대기 시간 히스토그램
+  // - counts[i]: 대기 시간이 [2^(i-1), 2^i) us 구간인 획득 수 (counts[0]은 1us 미만)
+  // - 마지막 구간은 그 이상을 모두 포함
+  struct LatencyHistogram {
+    static constexpr int kBuckets = 24;
+
+    std::array<std::uint64_t, kBuckets> counts{}; // 구간별 획득 수
+    std::uint64_t acquisitions = 0;               // 총 획득 수
+    std::uint64_t timeouts = 0;                   // 시간 초과/try_lock 실패 수
+    std::int64_t total_wait_us = 0;               // 총 대기 시간 (us)
+    std::int64_t max_wait_us = 0;                 // 최대 대기 시간 (us)
+
+    // 백분위 대기 시간의 상한 (us, 구간 경계 기준)
+    // @param percentile 0.0 ~ 1.0 (예: 0.99)
+    std::int64_t percentile_us(double percentile) const;
+  };
 
-    void lock();        // 높은 우선순위로 잠금을 수행합니다.
-    void unlock();      // 높은 우선순위의 잠금을 해제합니다.
-    bool try_to_lock(); // 높은 우선순위로 잠금을 시도합니다.
+  // 잠금 통계
+  struct Stats {
+    LatencyHistogram high;             // 높은 우선순위 잠금
+    LatencyHistogram low;              // 낮은 우선순위 잠금
+    std::uint64_t starvation_grants = 0; // 기아 방지 한도 때문에 낮은 우선순위에게 넘어간 횟수
+  };
 
-    // 복사 및 이동 연산 금지
-    HighMutex(HighMutex const&) = delete;
-    HighMutex(HighMutex &&) = delete;
-    HighMutex& operator=(HighMutex const&) = delete;
-    HighMutex& operator=(HighMutex &&) = delete;
+  static constexpr int kDefaultMaxConsecutiveHigh = 8;
 
-   private:
-    PriorityMutex& m_; // PriorityMutex 객체 참조
-  };
+ private:
+  enum class Priority { kHigh, kLow };
 
-  // LowMutex 클래스
-  // 낮은 우선순위의 mutex 잠금을 관리하는 내부 클래스입니다.
-  class LowMutex {
+  // 우선순위별 잠금 인터페이스 (Lockable)
+  template<Priority P>
+  class PriorityView {
    public:
     // 생성자
     // PriorityMutex 객체를 참조로 받아 초기화합니다.
-    explicit LowMutex(PriorityMutex& m) noexcept : m_(m) {}
-
-    void lock();        // 낮은 우선순위로 잠금을 수행합니다.
-    void unlock();      // 낮은 우선순위의 잠금을 해제합니다.
-    bool try_to_lock(); // 낮은 우선순위로 잠금을 시도합니다.
+    explicit PriorityView(PriorityMutex& m) noexcept : m_(m) {}
+
+    void lock() { m_.lock_impl(P, nullptr); }      // 잠금을 수행합니다.
+    void unlock() { m_.unlock_impl(); }            // 잠금을 해제합니다.
+    bool try_lock() { return m_.try_lock_impl(P); } // 대기하지 않고 잠금을 시도합니다.
+    bool try_to_lock() { return try_lock(); }      // 이전 이름 호환
+
+    // 주어진 시간 동안 잠금을 시도합니다.
+    template<typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout) {
+      const auto deadline = clock_type::now() + std::chrono::duration_cast<clock_type::duration>(timeout);
+      return m_.lock_impl(P, &deadline);
+    }
+
+    // 주어진 시각까지 잠금을 시도합니다.
+    template<typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& time) {
+      return try_lock_for(time - Clock::now());
+    }
 
     // 복사 및 이동 연산 금지
-    LowMutex(LowMutex const&) = delete;
-    LowMutex(LowMutex &&) = delete;
-    LowMutex& operator=(LowMutex const&) = delete;
-    LowMutex& operator=(LowMutex &&) = delete;
+    PriorityView(PriorityView const&) = delete;
+    PriorityView(PriorityView &&) = delete;
+    PriorityView& operator=(PriorityView const&) = delete;
+    PriorityView& operator=(PriorityView &&) = delete;
 
    private:
     PriorityMutex& m_; // PriorityMutex 객체 참조
@@ -56,26 +89,80 @@ class PriorityMutex {
 
  public:
   // 타입 정의
-  using mutex_type = std::mutex;          // 일반 mutex 타입
-  using low_mutex_type = LowMutex;        // 낮은 우선순위 mutex 타입
-  using high_mutex_type = HighMutex;      // 높은 우선순위 mutex 타입
+  using mutex_type = std::mutex;                      // 내부 상태 보호용 mutex 타입
+  using HighMutex = PriorityView<Priority::kHigh>;    // 높은 우선순위 잠금 인터페이스
+  using LowMutex = PriorityView<Priority::kLow>;      // 낮은 우선순위 잠금 인터페이스
+  using low_mutex_type = LowMutex;                    // 낮은 우선순위 mutex 타입
+  using high_mutex_type = HighMutex;                  // 높은 우선순위 mutex 타입
+
+  // @param max_consecutive_high 낮은 우선순위 대기 중 높은 우선순위가 연속으로 잠글 수 있는 최대 횟수
+  explicit PriorityMutex(int max_consecutive_high = kDefaultMaxConsecutiveHigh);
+
+  PriorityMutex(PriorityMutex const&) = delete;
+  PriorityMutex& operator=(PriorityMutex const&) = delete;
 
   // 낮은 우선순위 mutex 관련 메서드
   void lock_low();        // 낮은 우선순위로 잠금을 수행합니다.
   void unlock_low();      // 낮은 우선순위의 잠금을 해제합니다.
-  bool try_to_lock_low(); // 낮은 우선순위로 잠금을 시도합니다.
+  bool try_lock_low();    // 낮은 우선순위로 잠금을 시도합니다.
+  bool try_to_lock_low() { return try_lock_low(); } // 이전 이름 호환
   LowMutex& low();        // LowMutex 객체를 반환합니다.
 
   // 높은 우선순위 mutex 관련 메서드
   void lock_high();        // 높은 우선순위로 잠금을 수행합니다.
   void unlock_high();      // 높은 우선순위의 잠금을 해제합니다.
-  bool try_to_lock_high(); // 높은 우선순위로 잠금을 시도합니다.
+  bool try_lock_high();    // 높은 우선순위로 잠금을 시도합니다.
+  bool try_to_lock_high() { return try_lock_high(); } // 이전 이름 호환
   HighMutex& high();       // HighMutex 객체를 반환합니다.
 
+  // 기아 방지 한도 설정/조회 (1 이상)
+  void set_max_consecutive_high(int count);
+  int max_consecutive_high() const;
+
+  Stats stats() const;  // 잠금 통계를 반환합니다.
+  void reset_stats();   // 잠금 통계를 초기화합니다.
+
  private:
-  mutex_type m_;                  // mutex 객체
-  std::condition_variable cv_;    // 조건 변수 (낮은 우선순위 대기 관리)
-  std::atomic_int high_accessing_{0}; // 높은 우선순위 작업 수 (원자적 접근)
+  // 우선순위별 통계 (원자적 카운터)
+  struct AtomicHistogram {
+    std::array<std::atomic<std::uint64_t>, LatencyHistogram::kBuckets> counts{};
+    std::atomic<std::uint64_t> acquisitions{0};
+    std::atomic<std::uint64_t> timeouts{0};
+    std::atomic<std::int64_t> total_wait_us{0};
+    std::atomic<std::int64_t> max_wait_us{0};
+
+    void record(clock_type::duration wait);
+    void load(LatencyHistogram* out) const;
+    void reset();
+  };
+
+  // 잠금 획득 (deadline이 nullptr이면 무한 대기)
+  // @return 잠금을 얻었으면 true, 시간이 초과되면 false
+  bool lock_impl(Priority priority, const clock_type::time_point* deadline);
+  bool try_lock_impl(Priority priority);
+  void unlock_impl();
+
+  // 아래 메서드는 state_mutex_를 잡은 상태에서 호출
+  bool can_acquire(Priority priority) const; // 해당 우선순위가 지금 잠금을 얻을 수 있는지 확인
+  void acquire(Priority priority);           // 잠금 상태로 전환
+  void notify_next();                        // 다음에 잠금을 얻을 대기자를 깨움
+
+  AtomicHistogram& histogram(Priority priority) {
+    return priority == Priority::kHigh ? high_stats_ : low_stats_;
+  }
+
+  mutable mutex_type state_mutex_;   // 아래 상태 보호
+  std::condition_variable high_cv_;  // 높은 우선순위 대기
+  std::condition_variable low_cv_;   // 낮은 우선순위 대기
+  bool locked_ = false;              // 잠금 여부
+  int high_waiting_ = 0;             // 대기 중인 높은 우선순위 작업 수
+  int low_waiting_ = 0;              // 대기 중인 낮은 우선순위 작업 수
+  int consecutive_high_ = 0;         // 낮은 우선순위 대기 중 높은 우선순위가 연속으로 잠근 횟수
+  int max_consecutive_high_;         // 기아 방지 한도
+
+  AtomicHistogram high_stats_;
+  AtomicHistogram low_stats_;
+  std::atomic<std::uint64_t> starvation_grants_{0};
 
   low_mutex_type low_{*this};   // LowMutex 객체
   high_mutex_type high_{*this}; // HighMutex 객체
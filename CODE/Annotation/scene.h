@@ -0,0 +1,390 @@
+#ifndef EYEDID_CPP_SAMPLE_SCENE_H_
+#define EYEDID_CPP_SAMPLE_SCENE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+#include "drawables.h"
+
+namespace sample {
+namespace drawables {
+
+/**
+ * BasicScene 클래스:
+ * - 화면 요소를 보관하고 z 순서대로 그리는 장면(scene) 컨테이너
+ * - 요소는 종류별로 연속된 배열(std::vector<T>)에 저장되며, 요소마다 할당하지 않음
+ *   (삭제 시 마지막 요소를 빈 자리로 옮기므로 배열에 빈틈이 없음)
+ * - add()가 반환하는 handle로 요소를 찾으며, 삭제된 요소의 handle은 세대(generation) 값으로 무효화됨
+ * - 그리기 순서: 레이어 → z → 요소 종류(Ts 순서) → 추가 순서
+ *   (그릴 때는 같은 레이어에서 연속된 같은 종류의 요소를 한 묶음(batch)으로 그리므로,
+ *    종류를 묶음마다 한 번만 확인하고 묶음 안에서는 종류별 배열을 바로 순회함)
+ * - 레이어(0 ~ kMaxLayers-1)별로 표시 여부를 바꿀 수 있음
+ * - 그릴 때 clip 영역(화면)과 겹치지 않는 요소는 건너뜀 (culling)
+ * - 요소를 추가/삭제하거나 z/레이어를 바꾼 뒤에는 prepare()로 그리기 순서를 갱신해야 함
+ *   (View::update()가 자동으로 호출하므로 그리는 쪽은 정렬하지 않음)
+ *
+ * @tparam Ts 보관할 요소 종류 (bounds(), draw(dst, clip), operator==, visible 필요)
+ */
+template<typename... Ts>
+class BasicScene {
+ public:
+  static constexpr int kMaxLayers = 32;
+
+  // 요소를 가리키는 handle
+  struct handle {
+    static constexpr std::uint32_t kInvalid = 0xffffffffu;
+
+    std::uint32_t id = kInvalid;
+    std::uint32_t generation = 0;
+
+    explicit operator bool() const { return id != kInvalid; }
+    bool operator==(const handle& other) const { return id == other.id && generation == other.generation; }
+    bool operator!=(const handle& other) const { return !(*this == other); }
+  };
+
+  // 그리기 통계
+  struct DrawStats {
+    std::size_t drawn = 0;  // 그린 요소 수
+    std::size_t culled = 0; // clip 영역 밖이라 건너뛴 요소 수
+    std::size_t hidden = 0; // 숨겨진 레이어라 건너뛴 요소 수
+    std::size_t batches = 0; // 그린 묶음 수 (같은 레이어에서 연속된 같은 종류의 요소)
+  };
+
+  /**
+   * 요소 추가
+   * @param element 요소
+   * @param z       같은 레이어 안에서의 순서 (클수록 위에 그림)
+   * @param layer   레이어 (0 ~ kMaxLayers-1, 클수록 위에 그림)
+   * @return 요소의 handle
+   */
+  template<typename T>
+  handle add(T element, int z = 0, int layer = 0) {
+    using type = typename std::decay<T>::type;
+    constexpr auto type_index = index_of<type, Ts...>::value;
+    auto& pool = std::get<type_index>(pools_);
+
+    std::uint32_t id;
+    if (free_.empty()) {
+      id = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.emplace_back();
+    } else {
+      id = free_.back();
+      free_.pop_back();
+    }
+
+    auto& node = nodes_[id];
+    node.alive = true;
+    node.type = static_cast<std::uint8_t>(type_index);
+    node.index = static_cast<std::uint32_t>(pool.items.size());
+    node.z = z;
+    node.layer = static_cast<std::uint8_t>(clamp_layer(layer));
+    pool.items.push_back(std::move(element));
+    pool.ids.push_back(id);
+
+    order_dirty_ = true;
+    return handle{id, node.generation};
+  }
+
+  // 요소 삭제 (이미 삭제된 handle이면 false)
+  bool remove(handle h) {
+    if (!valid(h))
+      return false;
+
+    auto& node = nodes_[h.id];
+    erase_item<0>(node.type, node.index);
+    node.alive = false;
+    ++node.generation; // 기존 handle 무효화
+    free_.push_back(h.id);
+    order_dirty_ = true;
+    return true;
+  }
+
+  void clear() {
+    for (std::size_t id = 0; id < nodes_.size(); ++id) {
+      if (nodes_[id].alive) {
+        nodes_[id].alive = false;
+        ++nodes_[id].generation;
+        free_.push_back(static_cast<std::uint32_t>(id));
+      }
+    }
+    clear_pools<0>();
+    order_.clear();
+    order_dirty_ = false;
+  }
+
+  // handle이 가리키는 요소가 있는지 확인
+  bool valid(handle h) const {
+    return h.id < nodes_.size() && nodes_[h.id].alive && nodes_[h.id].generation == h.generation;
+  }
+
+  /**
+   * 요소 가져오기
+   * @return 요소 포인터, handle이 무효이거나 종류가 다르면 nullptr
+   *         (다른 요소를 추가/삭제하면 주소가 바뀔 수 있으므로 보관하지 말 것)
+   */
+  template<typename T>
+  T* get(handle h) {
+    constexpr auto type_index = index_of<T, Ts...>::value;
+    if (!valid(h) || nodes_[h.id].type != type_index)
+      return nullptr;
+    return &std::get<type_index>(pools_).items[nodes_[h.id].index];
+  }
+
+  template<typename T>
+  const T* get(handle h) const {
+    return const_cast<BasicScene*>(this)->template get<T>(h);
+  }
+
+  void set_z(handle h, int z) {
+    if (valid(h) && nodes_[h.id].z != z) {
+      nodes_[h.id].z = z;
+      order_dirty_ = true;
+    }
+  }
+
+  void set_layer(handle h, int layer) {
+    if (valid(h)) {
+      nodes_[h.id].layer = static_cast<std::uint8_t>(clamp_layer(layer));
+      order_dirty_ = true;
+    }
+  }
+
+  // 레이어 표시 여부 설정
+  void set_layer_visible(int layer, bool visible) {
+    const auto bit = std::uint32_t{1} << clamp_layer(layer);
+    hidden_layers_ = visible ? (hidden_layers_ & ~bit) : (hidden_layers_ | bit);
+  }
+
+  bool layer_visible(int layer) const {
+    return (hidden_layers_ & (std::uint32_t{1} << clamp_layer(layer))) == 0;
+  }
+
+  // 요소 수
+  std::size_t size() const { return nodes_.size() - free_.size(); }
+
+  // 특정 종류의 요소 배열 (연속 메모리, 순서는 그리기 순서와 다름)
+  template<typename T>
+  const std::vector<T>& items() const { return std::get<index_of<T, Ts...>::value>(pools_).items; }
+
+  // prepare()로 그리기 순서를 갱신해야 하는지 여부
+  bool needs_prepare() const { return order_dirty_; }
+
+  // 그리기 순서 갱신 (요소/z/레이어가 바뀌었을 때만 정렬)
+  void prepare() {
+    if (!order_dirty_)
+      return;
+
+    order_.clear();
+    for (std::uint32_t id = 0; id < nodes_.size(); ++id) {
+      if (nodes_[id].alive)
+        order_.push_back(id);
+    }
+    std::sort(order_.begin(), order_.end(), [this](std::uint32_t a, std::uint32_t b) {
+      const auto& na = nodes_[a];
+      const auto& nb = nodes_[b];
+      if (na.layer != nb.layer) return na.layer < nb.layer;
+      if (na.z != nb.z) return na.z < nb.z;
+      if (na.type != nb.type) return na.type < nb.type;
+      return a < b;
+    });
+    order_dirty_ = false;
+  }
+
+  // 모든 요소를 그리기
+  DrawStats draw(cv::Mat* dst) const {
+    return draw(dst, cv::Rect(0, 0, dst->cols, dst->rows));
+  }
+
+  /**
+   * clip 영역과 겹치는 요소만 clip 영역 안에 그리기
+   * - prepare() 이후의 순서로 그림
+   */
+  DrawStats draw(cv::Mat* dst, const cv::Rect& clip) const {
+    DrawStats stats;
+    std::size_t first = 0;
+    while (first < order_.size()) {
+      const auto& head = nodes_[order_[first]];
+      auto last = first + 1;
+      while (last < order_.size() && nodes_[order_[last]].layer == head.layer &&
+             nodes_[order_[last]].type == head.type)
+        ++last;
+
+      if (!layer_visible(head.layer)) {
+        stats.hidden += last - first;
+      } else {
+        draw_batch<0>(head.type, first, last, dst, clip, &stats);
+        ++stats.batches;
+      }
+      first = last;
+    }
+    return stats;
+  }
+
+  /**
+   * 이전 장면과 비교하여 다시 그려야 할 영역을 추가
+   * - 바뀐(추가/삭제/이동/변경/레이어 표시 변경) 요소의 이전 영역과 현재 영역
+   * @param previous 마지막으로 그린 장면
+   * @param damage   영역을 추가할 목록
+   */
+  void collect_damage(const BasicScene& previous, std::vector<cv::Rect>* damage) const {
+    const auto n = std::max(nodes_.size(), previous.nodes_.size());
+    for (std::size_t id = 0; id < n; ++id) {
+      const Node* before = id < previous.nodes_.size() && previous.nodes_[id].alive ? &previous.nodes_[id] : nullptr;
+      const Node* after = id < nodes_.size() && nodes_[id].alive ? &nodes_[id] : nullptr;
+      if (before == nullptr && after == nullptr)
+        continue;
+
+      if (before != nullptr && after != nullptr && before->generation == after->generation &&
+          before->type == after->type && before->z == after->z && before->layer == after->layer &&
+          previous.layer_visible(before->layer) == layer_visible(after->layer) &&
+          equal_item<0>(previous, before->index, after->type, after->index))
+        continue;
+
+      if (before != nullptr && previous.layer_visible(before->layer))
+        previous.bounds_item<0>(before->type, before->index, damage);
+      if (after != nullptr && layer_visible(after->layer))
+        bounds_item<0>(after->type, after->index, damage);
+    }
+  }
+
+ private:
+  // 요소 종류의 위치 (Ts 안에서의 순서)
+  template<typename T, typename... Us>
+  struct index_of;
+
+  template<typename T, typename... Us>
+  struct index_of<T, T, Us...> : std::integral_constant<std::size_t, 0> {};
+
+  template<typename T, typename U, typename... Us>
+  struct index_of<T, U, Us...> : std::integral_constant<std::size_t, 1 + index_of<T, Us...>::value> {};
+
+  // 종류별 연속 배열 (ids[i]는 items[i]의 node id)
+  template<typename T>
+  struct Pool {
+    std::vector<T> items;
+    std::vector<std::uint32_t> ids;
+  };
+
+  struct Node {
+    std::uint32_t generation = 0;
+    std::uint32_t index = 0; // 종류별 배열 안의 위치
+    int z = 0;
+    std::uint8_t type = 0;
+    std::uint8_t layer = 0;
+    bool alive = false;
+  };
+
+  static int clamp_layer(int layer) {
+    return std::min(std::max(layer, 0), kMaxLayers - 1);
+  }
+
+  // 요소 종류(type)에 따라 I번째 배열로 분기하는 함수들
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Ts))>::type erase_item(std::uint8_t type, std::uint32_t index) {
+    if (type != I)
+      return erase_item<I + 1>(type, index);
+
+    auto& pool = std::get<I>(pools_);
+    const auto last = pool.items.size() - 1;
+    if (index != last) { // 마지막 요소를 빈 자리로 옮김
+      pool.items[index] = std::move(pool.items[last]);
+      pool.ids[index] = pool.ids[last];
+      nodes_[pool.ids[index]].index = index;
+    }
+    pool.items.pop_back();
+    pool.ids.pop_back();
+  }
+
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Ts))>::type erase_item(std::uint8_t, std::uint32_t) {}
+
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Ts))>::type clear_pools() {
+    std::get<I>(pools_).items.clear();
+    std::get<I>(pools_).ids.clear();
+    clear_pools<I + 1>();
+  }
+
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Ts))>::type clear_pools() {}
+
+  // order_[first, last)의 요소(모두 종류 I)를 그리기 (종류는 묶음마다 한 번만 확인)
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Ts))>::type
+  draw_batch(std::uint8_t type, std::size_t first, std::size_t last, cv::Mat* dst, const cv::Rect& clip,
+             DrawStats* stats) const {
+    if (type != I) {
+      draw_batch<I + 1>(type, first, last, dst, clip, stats);
+      return;
+    }
+
+    const auto& items = std::get<I>(pools_).items;
+    for (auto i = first; i < last; ++i) {
+      const auto& item = items[nodes_[order_[i]].index];
+      if (!item.visible || (item.bounds() & clip).empty()) {
+        ++stats->culled;
+        continue;
+      }
+      item.draw(dst, clip);
+      ++stats->drawn;
+    }
+  }
+
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Ts))>::type
+  draw_batch(std::uint8_t, std::size_t, std::size_t, cv::Mat*, const cv::Rect&, DrawStats*) const {}
+
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Ts)), bool>::type
+  equal_item(const BasicScene& previous, std::uint32_t before, std::uint8_t type, std::uint32_t after) const {
+    if (type != I)
+      return equal_item<I + 1>(previous, before, type, after);
+    return std::get<I>(previous.pools_).items[before] == std::get<I>(pools_).items[after];
+  }
+
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Ts)), bool>::type
+  equal_item(const BasicScene&, std::uint32_t, std::uint8_t, std::uint32_t) const { return true; }
+
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Ts))>::type
+  bounds_item(std::uint8_t type, std::uint32_t index, std::vector<cv::Rect>* damage) const {
+    if (type != I)
+      return bounds_item<I + 1>(type, index, damage);
+
+    const auto& item = std::get<I>(pools_).items[index];
+    if (item.visible)
+      damage->push_back(item.bounds());
+  }
+
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Ts))>::type
+  bounds_item(std::uint8_t, std::uint32_t, std::vector<cv::Rect>*) const {}
+
+  std::tuple<Pool<Ts>...> pools_;
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> free_;  // 재사용할 node id
+  std::vector<std::uint32_t> order_; // 그리기 순서 (node id)
+  bool order_dirty_ = false;
+  std::uint32_t hidden_layers_ = 0;  // 숨긴 레이어 비트
+};
+
+template<typename... Ts>
+constexpr int BasicScene<Ts...>::kMaxLayers;
+
+template<typename... Ts>
+constexpr std::uint32_t BasicScene<Ts...>::handle::kInvalid;
+
+// View에서 사용하는 기본 장면 (같은 레이어/z에서는 이미지 → 반투명 이미지 → 도형 → 텍스트 순으로 그림)
+using Scene = BasicScene<Image, Overlay, Rectangle, Circle, Polyline, Text>;
+
+} // namespace drawables
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_SCENE_H_
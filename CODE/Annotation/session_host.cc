@@ -0,0 +1,528 @@
+#include "session_host.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+#include "latency_trace.h"
+#include "thread_affinity.h"
+
+namespace sample {
+
+constexpr SessionHost::SessionId SessionHost::kInvalidSession;
+
+namespace {
+
+constexpr auto kReadBackoff = std::chrono::milliseconds(10);  // 프레임 소스 읽기 실패 후 다시 시도할 때까지
+constexpr auto kIdleTimeout = std::chrono::milliseconds(100); // 실행할 세션이 없을 때 최대 대기 시간
+
+std::int64_t to_ns(std::chrono::steady_clock::time_point t) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+// 값을 최댓값에 반영
+void update_max(std::atomic<std::int64_t>& max, std::int64_t value) {
+  auto current = max.load(std::memory_order_relaxed);
+  while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+} // namespace
+
+// **Session 클래스**
+SessionHost::Session::Session(SessionId id, std::shared_ptr<TrackerManager> tracker,
+                              std::unique_ptr<FrameSource> source, const SessionOptions& options)
+: id(id),
+  options(options),
+  tracker(std::move(tracker)),
+  queue(std::max<std::size_t>(options.queue_depth, 1)),
+  source(std::move(source)),
+  converter(options.target_size) {}
+
+// 큐가 가득 차면 kDropOldest는 가장 오래된 칸(다음에 쓸 칸)을 덮어쓰고, kReject는 거부
+bool SessionHost::Session::enqueue(const FrameEnvelope& envelope) {
+  std::lock_guard<std::mutex> lck(queue_mutex);
+  const auto capacity = queue.size();
+  if (queue_size == capacity) {
+    if (options.backpressure == Backpressure::kReject) {
+      rejected.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    queue_head = (queue_head + 1) % capacity;
+    --queue_size;
+    dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto& slot = queue[(queue_head + queue_size) % capacity];
+  slot = envelope;
+  slot.source_id = id;
+  ++queue_size;
+  received.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool SessionHost::Session::dequeue(FrameEnvelope* envelope) {
+  std::lock_guard<std::mutex> lck(queue_mutex);
+  if (queue_size == 0)
+    return false;
+  *envelope = queue[queue_head];
+  queue[queue_head].frame.release(); // 처리가 끝나면 바로 버퍼를 놓도록 참조는 하나만 남김
+  queue_head = (queue_head + 1) % queue.size();
+  --queue_size;
+  return true;
+}
+
+void SessionHost::Session::clear_queue() {
+  std::lock_guard<std::mutex> lck(queue_mutex);
+  for (std::size_t i = 0; i < queue_size; ++i)
+    queue[(queue_head + i) % queue.size()].frame.release();
+  dropped.fetch_add(queue_size, std::memory_order_relaxed);
+  queue_head = 0;
+  queue_size = 0;
+}
+
+bool SessionHost::Session::has_work() {
+  {
+    std::lock_guard<std::mutex> lck(queue_mutex);
+    if (queue_size != 0)
+      return true;
+  }
+  std::lock_guard<std::mutex> lck(source_mutex);
+  return running.load() && source_open;
+}
+
+// push()로 들어온 프레임을 먼저 처리하고, 없으면 프레임 소스에서 한 프레임을 읽음
+SessionHost::StepResult SessionHost::Session::step() {
+  if (!dequeue(&input)) {
+    if (!running.load())
+      return StepResult::kIdle;
+
+    std::lock_guard<std::mutex> lck(source_mutex);
+    if (!source_open)
+      return StepResult::kIdle;
+    if (!source->read(read_buffer)) {
+      if (source->end_of_stream()) { // 파일 끝: 다시 읽어도 실패하므로 세션을 멈춤
+        running.store(false);
+        ended.store(true);
+        source->close();
+        source_open = false;
+        return StepResult::kEnded;
+      }
+      read_failures.fetch_add(1, std::memory_order_relaxed); // 읽기 실패 또는 시간 초과
+      return StepResult::kBackoff;
+    }
+    const auto read_ns = LatencyTracer::now_ns();
+    input.frame = read_buffer;
+    input.sequence = ++sequence;
+    input.source_id = id;
+    input.hardware_timestamp = source->capture_timestamp(&input.capture_ns);
+    if (!input.hardware_timestamp)
+      input.capture_ns = read_ns;
+    LatencyTracer::instance().note_capture(input.trace_id(), input.capture_ns);
+    received.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (input.frame.empty())
+    return StepResult::kMore;
+
+  TraceSpan span(TraceStage::kSubmit, input.trace_id());
+  converter.convert(input.frame, &converted);
+  rgb_envelope = input;
+  rgb_envelope.frame = converted; // 캡처 정보는 그대로 두고 변환된 프레임으로 교체
+  const bool added = tracker->addFrame(rgb_envelope);
+  rgb_envelope.frame.release();
+  input.frame.release();
+
+  if (added)
+    processed.fetch_add(1, std::memory_order_relaxed);
+  else
+    tracker_rejected.fetch_add(1, std::memory_order_relaxed);
+  return StepResult::kMore;
+}
+
+// **SessionHost 클래스**
+SessionHost::SessionHost()
+: SessionHost(Options()) {}
+
+SessionHost::SessionHost(const Options& options)
+: options_(options),
+  created_(clock::now()) {
+  const auto count = options_.workers != 0 ? options_.workers : static_cast<std::size_t>(hardware_cores());
+  workers_.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    workers_.emplace_back(new Worker());
+
+  // 모든 Worker를 만든 뒤에 스레드를 시작 (다른 스레드의 큐를 훔쳐 가므로)
+  const auto cores = options_.pin_threads ? allowed_cores() : std::vector<int>();
+  for (std::size_t i = 0; i < count; ++i) {
+    workers_[i]->thread = std::thread([this, i]() {
+      run_impl(i);
+    });
+    if (!options_.pin_threads)
+      continue;
+    const auto slot = static_cast<std::size_t>(options_.first_core) + i;
+    if (options_.first_core < 0 || slot >= cores.size())
+      std::cerr << "Not enough cores to pin session worker " << i << " (" << cores.size() << " allowed); running unpinned\n";
+    else
+      pin_thread(workers_[i]->thread, cores[slot]);
+  }
+}
+
+SessionHost::~SessionHost() {
+  join();
+}
+
+SessionHost::SessionId SessionHost::create_session(std::shared_ptr<TrackerManager> tracker,
+                                                   std::unique_ptr<FrameSource> source) {
+  return create_session(std::move(tracker), std::move(source), SessionOptions());
+}
+
+SessionHost::SessionId SessionHost::create_session(std::shared_ptr<TrackerManager> tracker,
+                                                   std::unique_ptr<FrameSource> source,
+                                                   const SessionOptions& options) {
+  if (!tracker)
+    return kInvalidSession;
+
+  std::lock_guard<std::mutex> lck(sessions_mutex_);
+  const auto id = static_cast<SessionId>(sessions_.size());
+  sessions_.push_back(std::make_shared<Session>(id, std::move(tracker), std::move(source), options));
+  return id;
+}
+
+bool SessionHost::start_session(SessionId id) {
+  auto session = find(id);
+  if (!session || stop_.load())
+    return false;
+
+  {
+    std::lock_guard<std::mutex> lck(session->source_mutex);
+    if (session->source && !session->source_open) {
+      if (!session->source->open()) {
+        std::cerr << "Failed to open " << session->source->name() << '\n';
+        return false;
+      }
+      session->source_open = true;
+    }
+  }
+
+  session->start_ns.store(LatencyTracer::now_ns(), std::memory_order_relaxed);
+  session->ended.store(false);
+  session->running.store(true);
+  schedule(session, id % workers_.size());
+  return true;
+}
+
+bool SessionHost::stop_session(SessionId id) {
+  auto session = find(id);
+  if (!session)
+    return false;
+
+  session->running.store(false);
+  session->clear_queue();
+  std::lock_guard<std::mutex> lck(session->source_mutex); // 작업 스레드가 읽는 중이면 끝날 때까지 대기
+  if (session->source_open) {
+    session->source->close();
+    session->source_open = false;
+  }
+  return true;
+}
+
+bool SessionHost::remove_session(SessionId id) {
+  if (!stop_session(id))
+    return false;
+
+  std::lock_guard<std::mutex> lck(sessions_mutex_);
+  sessions_[id].reset(); // 작업 스레드 큐나 타이머에 남은 참조는 다음 실행에서 사라짐
+  return true;
+}
+
+bool SessionHost::push(SessionId id, const FrameEnvelope& envelope) {
+  auto session = find(id);
+  if (!session || !session->running.load())
+    return false;
+  if (!session->enqueue(envelope))
+    return false;
+
+  schedule(session, id % workers_.size());
+  return true;
+}
+
+bool SessionHost::session_stats(SessionId id, SessionStats* stats) const {
+  auto session = find(id);
+  if (!session)
+    return false;
+
+  *stats = SessionStats();
+  stats->running = session->running.load(std::memory_order_relaxed);
+  stats->ended = session->ended.load(std::memory_order_relaxed);
+  stats->received = session->received.load(std::memory_order_relaxed);
+  stats->processed = session->processed.load(std::memory_order_relaxed);
+  stats->dropped = session->dropped.load(std::memory_order_relaxed);
+  stats->rejected = session->rejected.load(std::memory_order_relaxed);
+  stats->tracker_rejected = session->tracker_rejected.load(std::memory_order_relaxed);
+  stats->read_failures = session->read_failures.load(std::memory_order_relaxed);
+  stats->migrations = session->migrations.load(std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lck(session->queue_mutex);
+    stats->queued = session->queue_size;
+  }
+
+  const auto steps = stats->processed + stats->tracker_rejected;
+  if (steps != 0)
+    stats->mean_step_us = session->total_step_us.load(std::memory_order_relaxed) / static_cast<std::int64_t>(steps);
+  stats->max_step_us = session->max_step_us.load(std::memory_order_relaxed);
+
+  const auto start_ns = session->start_ns.load(std::memory_order_relaxed);
+  if (start_ns != 0 && LatencyTracer::now_ns() > start_ns)
+    stats->fps = static_cast<double>(stats->processed) * 1e9 / static_cast<double>(LatencyTracer::now_ns() - start_ns);
+  return true;
+}
+
+SessionHost::Stats SessionHost::stats() const {
+  Stats stats;
+  stats.workers = workers_.size();
+  {
+    std::lock_guard<std::mutex> lck(sessions_mutex_);
+    for (const auto& session : sessions_) {
+      if (!session)
+        continue;
+      ++stats.sessions;
+      if (session->running.load(std::memory_order_relaxed))
+        ++stats.running;
+    }
+  }
+
+  stats.worker_steps.reserve(workers_.size());
+  for (const auto& worker : workers_) {
+    const auto steps = worker->steps.load(std::memory_order_relaxed);
+    stats.worker_steps.push_back(steps);
+    stats.steps += steps;
+  }
+  stats.steals = steals_.load(std::memory_order_relaxed);
+  stats.idle_waits = idle_waits_.load(std::memory_order_relaxed);
+  stats.elapsed_s = std::chrono::duration<double>(clock::now() - created_).count();
+  if (stats.elapsed_s > 0.0)
+    stats.steps_per_s = static_cast<double>(stats.steps) / stats.elapsed_s;
+  return stats;
+}
+
+void SessionHost::join() {
+  {
+    std::lock_guard<std::mutex> lck(sessions_mutex_);
+    for (const auto& session : sessions_) {
+      if (session)
+        session->running.store(false);
+    }
+  }
+
+  stop_.store(true);
+  {
+    std::lock_guard<std::mutex> lck(idle_mutex_);
+  }
+  idle_cv_.notify_all();
+
+  for (auto& worker : workers_) {
+    if (worker->thread.joinable())
+      worker->thread.join();
+  }
+
+  // 작업 스레드가 모두 끝났으므로 잠금 없이 정리
+  for (auto& worker : workers_)
+    worker->sessions.clear();
+  timers_.clear();
+  next_due_ns_.store(0);
+  runnable_.store(0);
+
+  std::lock_guard<std::mutex> lck(sessions_mutex_);
+  for (const auto& session : sessions_) {
+    if (!session)
+      continue;
+    session->clear_queue();
+    std::lock_guard<std::mutex> source_lck(session->source_mutex);
+    if (session->source_open) {
+      session->source->close();
+      session->source_open = false;
+    }
+  }
+}
+
+// 작업 스레드
+// - 자기 큐 → 다른 스레드의 큐 순으로 찾고, 없으면 대기
+// - 읽을 시각이 된 세션은 자기 큐 뒤에 넣어 다른 세션과 차례를 지킴 (과부하에서 push() 세션이 밀려나지 않도록)
+void SessionHost::run_impl(std::size_t index) {
+  LatencyTracer::set_thread_name("session_worker");
+  while (!stop_.load()) {
+    release_timers(index);
+    auto session = pop_local(index);
+    if (!session)
+      session = steal(index);
+    if (session) {
+      run(index, std::move(session));
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lck(idle_mutex_);
+    idle_.fetch_add(1);
+    idle_waits_.fetch_add(1, std::memory_order_relaxed);
+    auto deadline = clock::now() + kIdleTimeout;
+    const auto next_due_ns = next_due_ns_.load();
+    if (next_due_ns != 0)
+      deadline = std::min(deadline, clock::time_point(std::chrono::nanoseconds(next_due_ns)));
+    idle_cv_.wait_until(lck, deadline, [this]() -> bool {
+      return stop_.load() || runnable_.load() != 0;
+    });
+    idle_.fetch_sub(1);
+  }
+}
+
+// 세션을 한 번 실행하고 다음 차례를 정함
+// - 더 처리할 것이 있으면 같은 작업 스레드의 큐 뒤로 (fps 제한에 걸리면 타이머로)
+// - 없으면 scheduled를 내린 뒤 다시 확인 (그 사이에 push()된 프레임을 놓치지 않도록)
+void SessionHost::run(std::size_t index, std::shared_ptr<Session> session) {
+  const auto last_worker = session->last_worker.load(std::memory_order_relaxed);
+  if (last_worker != index) {
+    if (last_worker != ~std::size_t{0})
+      session->migrations.fetch_add(1, std::memory_order_relaxed);
+    session->last_worker.store(index, std::memory_order_relaxed);
+  }
+
+  const auto begin = clock::now();
+  const auto result = session->step();
+  const auto end = clock::now();
+  workers_[index]->steps.fetch_add(1, std::memory_order_relaxed);
+
+  switch (result) {
+    case StepResult::kMore: {
+      const auto step_us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+      session->total_step_us.fetch_add(step_us, std::memory_order_relaxed);
+      update_max(session->max_step_us, step_us);
+
+      if (session->options.fps > 0.0 && session->source) {
+        const auto interval = std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(1.0 / session->options.fps));
+        session->next_read += interval;
+        if (session->next_read < begin)
+          session->next_read = begin + interval; // 한 주기 넘게 밀렸으면 따라잡지 않고 지금부터 다시 셈
+        if (session->next_read > end) {
+          const auto due = session->next_read;
+          defer(std::move(session), due);
+          return;
+        }
+      }
+      enqueue(index, std::move(session));
+      return;
+    }
+    case StepResult::kBackoff:
+      defer(std::move(session), end + kReadBackoff);
+      return;
+    case StepResult::kIdle:
+    case StepResult::kEnded:
+      session->scheduled.store(false);
+      if (session->has_work())
+        schedule(session, index);
+      return;
+  }
+}
+
+void SessionHost::schedule(const std::shared_ptr<Session>& session, std::size_t index) {
+  if (session->scheduled.exchange(true))
+    return; // 이미 큐나 타이머에 있거나 실행 중 (실행이 끝나면 다시 확인함)
+  const auto last_worker = session->last_worker.load(std::memory_order_relaxed);
+  if (last_worker < workers_.size())
+    index = last_worker; // 마지막으로 실행한 작업 스레드의 캐시에 세션 상태가 남아 있음
+  enqueue(index, session);
+}
+
+void SessionHost::enqueue(std::size_t index, std::shared_ptr<Session> session) {
+  {
+    auto& worker = *workers_[index];
+    std::lock_guard<std::mutex> lck(worker.mutex);
+    worker.sessions.push_back(std::move(session));
+  }
+  runnable_.fetch_add(1);
+
+  if (idle_.load() != 0) {
+    { std::lock_guard<std::mutex> lck(idle_mutex_); } // 대기 직전의 작업 스레드가 알림을 놓치지 않도록 함
+    idle_cv_.notify_one();
+  }
+}
+
+void SessionHost::defer(std::shared_ptr<Session> session, clock::time_point due) {
+  const auto later = [](const Timer& a, const Timer& b) { return a.due > b.due; };
+  bool earliest;
+  {
+    std::lock_guard<std::mutex> lck(timer_mutex_);
+    Timer timer;
+    timer.due = due;
+    timer.session = std::move(session);
+    timers_.push_back(std::move(timer));
+    std::push_heap(timers_.begin(), timers_.end(), later);
+    earliest = timers_.front().due == due;
+    next_due_ns_.store(to_ns(timers_.front().due));
+  }
+
+  // 대기 중인 작업 스레드가 더 늦은 시각까지 자고 있을 수 있으므로 깨워서 대기 시각을 다시 정하게 함
+  if (earliest && idle_.load() != 0) {
+    { std::lock_guard<std::mutex> lck(idle_mutex_); }
+    idle_cv_.notify_one();
+  }
+}
+
+std::shared_ptr<SessionHost::Session> SessionHost::pop_local(std::size_t index) {
+  auto& worker = *workers_[index];
+  std::lock_guard<std::mutex> lck(worker.mutex);
+  if (worker.sessions.empty())
+    return nullptr;
+  auto session = std::move(worker.sessions.front());
+  worker.sessions.pop_front();
+  runnable_.fetch_sub(1);
+  return session;
+}
+
+// 다른 작업 스레드의 큐 뒤쪽에서 가져옴 (잠겨 있는 큐는 건너뜀)
+std::shared_ptr<SessionHost::Session> SessionHost::steal(std::size_t index) {
+  if (runnable_.load() == 0)
+    return nullptr;
+
+  const auto count = workers_.size();
+  for (std::size_t k = 1; k < count; ++k) {
+    auto& worker = *workers_[(index + k) % count];
+    std::unique_lock<std::mutex> lck(worker.mutex, std::try_to_lock);
+    if (!lck.owns_lock() || worker.sessions.empty())
+      continue;
+    auto session = std::move(worker.sessions.back());
+    worker.sessions.pop_back();
+    runnable_.fetch_sub(1);
+    steals_.fetch_add(1, std::memory_order_relaxed);
+    return session;
+  }
+  return nullptr;
+}
+
+// 읽을 시각이 된 세션이 없으면 잠그지 않고 바로 반환
+void SessionHost::release_timers(std::size_t index) {
+  const auto next_due_ns = next_due_ns_.load(std::memory_order_relaxed);
+  if (next_due_ns == 0 || next_due_ns > LatencyTracer::now_ns())
+    return;
+
+  const auto later = [](const Timer& a, const Timer& b) { return a.due > b.due; };
+  std::vector<std::shared_ptr<Session>> due; // 보통 한두 개
+  {
+    std::lock_guard<std::mutex> lck(timer_mutex_);
+    const auto now = clock::now();
+    while (!timers_.empty() && timers_.front().due <= now) {
+      std::pop_heap(timers_.begin(), timers_.end(), later);
+      due.push_back(std::move(timers_.back().session));
+      timers_.pop_back();
+    }
+    next_due_ns_.store(timers_.empty() ? 0 : to_ns(timers_.front().due));
+  }
+  for (auto& session : due)
+    enqueue(index, std::move(session));
+}
+
+std::shared_ptr<SessionHost::Session> SessionHost::find(SessionId id) const {
+  std::lock_guard<std::mutex> lck(sessions_mutex_);
+  return id < sessions_.size() ? sessions_[id] : nullptr;
+}
+
+} // namespace sample
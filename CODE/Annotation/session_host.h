@@ -0,0 +1,248 @@
+#ifndef EYEDID_CPP_SAMPLE_SESSION_HOST_H_
+#define EYEDID_CPP_SAMPLE_SESSION_HOST_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "color_resize.h"
+#include "frame_envelope.h"
+#include "frame_source.h"
+#include "opencv2/opencv.hpp"
+#include "tracker_manager.h"
+
+namespace sample {
+
+/**
+ * SessionHost 클래스:
+ * - 한 프로세스에서 여러 추적 세션(TrackerManager 하나 = 세션 하나)을 고정된 개수의 작업 스레드로 실행
+ * - 세션의 프레임 입력
+ *   - 프레임 소스: 작업 스레드가 세션을 실행할 때마다 한 프레임씩 읽음 (녹화 파일, 공유 메모리, 합성 프레임)
+ *     처리한 만큼만 읽으므로 추적이 밀리면 읽기도 늦어짐 (소스는 기다리지 않고 바로 반환하는 설정으로 사용:
+ *     VideoFileFrameSource의 realtime = false, SyntheticFrameSource의 fps = 0, 속도는 SessionOptions::fps로 제한)
+ *   - push(): 외부 스레드(CameraThread::on_frame_ 등)가 넣는 프레임, 세션별 고정 크기 큐에 보관
+ *     큐가 가득 차면 Backpressure에 따라 가장 오래된 프레임을 버리거나 push()가 false를 반환
+ * - 스케줄링
+ *   - 세션 하나는 한 번에 한 작업 스레드에서만 실행되며 (프레임 순서 유지), 실행할 때마다 프레임 하나를 처리
+ *   - 작업 스레드마다 실행할 세션 큐가 있고, 처리한 세션은 같은 스레드의 큐 뒤로 돌아감 (캐시 유지)
+ *   - 자기 큐가 비면 다른 스레드 큐의 뒤쪽에서 세션을 가져옴 (work stealing)
+ * - 세션의 TrackerManager는 initialize()를 마친 상태여야 함 (SDK 없이 측정하려면 StubGazeTracker로 초기화)
+ * - 공개 메서드는 어느 스레드에서나 호출 가능
+ */
+class SessionHost {
+ public:
+  using SessionId = std::uint32_t;
+  static constexpr SessionId kInvalidSession = ~SessionId{0};
+
+  // push() 큐가 가득 찼을 때의 처리
+  enum class Backpressure {
+    kDropOldest, // 가장 오래된 프레임을 버리고 넣음 (항상 최신 프레임 위주로 처리)
+    kReject,     // 넣지 않고 false 반환 (보내는 쪽이 속도를 줄임)
+  };
+
+  struct Options {
+    std::size_t workers = 0;   // 작업 스레드 수 (0이면 코어 수)
+    bool pin_threads = false;  // 작업 스레드 i를 allowed_cores()의 first_core + i번째 코어에 고정
+    int first_core = 0;
+  };
+
+  struct SessionOptions {
+    std::size_t queue_depth = 2;                         // push() 큐 크기 (최소 1)
+    Backpressure backpressure = Backpressure::kDropOldest;
+    double fps = 0.0;                                    // 프레임 소스를 읽는 최대 속도 (0 이하면 제한 없음)
+    cv::Size target_size;                                // SDK에 전달할 프레임 크기 (비어 있으면 원본 유지)
+  };
+
+  // 세션별 통계
+  struct SessionStats {
+    bool running = false;
+    bool ended = false;                 // 프레임 소스가 끝나(end_of_stream) 세션이 멈춤
+    std::uint64_t received = 0;         // 받은 프레임 수 (push + 소스)
+    std::uint64_t processed = 0;        // addFrame으로 전달한 프레임 수
+    std::uint64_t dropped = 0;          // 큐에서 처리되기 전에 버려진 프레임 수
+    std::uint64_t rejected = 0;         // 큐가 가득 차 push()가 거부한 프레임 수
+    std::uint64_t tracker_rejected = 0; // addFrame이 실패한 프레임 수
+    std::uint64_t read_failures = 0;    // 프레임 소스 읽기 실패 횟수 (소스 끝은 제외)
+    std::uint64_t migrations = 0;       // 직전과 다른 작업 스레드에서 실행된 횟수
+    std::size_t queued = 0;             // 현재 큐에 있는 프레임 수
+    double fps = 0.0;                   // start_session() 이후 평균 처리 속도
+    std::int64_t mean_step_us = 0;      // 프레임 하나의 처리 시간 (변환 + addFrame)
+    std::int64_t max_step_us = 0;
+  };
+
+  // 전체 통계
+  struct Stats {
+    std::size_t workers = 0;
+    std::size_t sessions = 0;     // 만든 세션 수 (제거된 세션 제외)
+    std::size_t running = 0;      // 실행 중인 세션 수
+    std::uint64_t steps = 0;      // 세션 실행 횟수 (처리한 프레임 + 읽기 실패)
+    std::uint64_t steals = 0;     // 다른 작업 스레드에서 가져온 횟수
+    std::uint64_t idle_waits = 0; // 실행할 세션이 없어 대기한 횟수
+    double elapsed_s = 0.0;       // SessionHost 생성 이후 시간 (초)
+    double steps_per_s = 0.0;
+    std::vector<std::uint64_t> worker_steps; // 작업 스레드별 실행 횟수
+  };
+
+  SessionHost();
+  explicit SessionHost(const Options& options);
+  ~SessionHost();
+
+  SessionHost(const SessionHost&) = delete;
+  SessionHost& operator=(const SessionHost&) = delete;
+
+  /**
+   * 세션 만들기 (start_session() 전까지는 실행하지 않음)
+   * @param tracker 초기화된 TrackerManager
+   * @param source  프레임 소스 (nullptr이면 push()로만 입력)
+   * @return 세션 번호 (프레임의 source_id로도 사용), tracker가 nullptr이면 kInvalidSession
+   */
+  SessionId create_session(std::shared_ptr<TrackerManager> tracker, std::unique_ptr<FrameSource> source = nullptr);
+  SessionId create_session(std::shared_ptr<TrackerManager> tracker, std::unique_ptr<FrameSource> source,
+                           const SessionOptions& options);
+
+  /**
+   * 세션 실행 (프레임 소스가 있으면 열기)
+   * - 프레임 소스가 끝나면(end_of_stream) 큐에 남은 프레임까지 처리한 뒤 소스를 닫고 멈춤 (다시 start_session() 가능)
+   * @return 세션이 없거나 소스를 열지 못하면 false
+   */
+  bool start_session(SessionId id);
+
+  // 세션을 멈추고 큐의 프레임을 버림 (프레임 소스는 닫음, 다시 start_session() 가능)
+  bool stop_session(SessionId id);
+
+  // 세션을 멈추고 제거 (작업 스레드가 실행 중이면 그 프레임까지 처리한 뒤 해제)
+  bool remove_session(SessionId id);
+
+  /**
+   * 세션에 프레임 전달 (BGR, 픽셀 데이터는 복사하지 않고 참조만 보관)
+   * - envelope.source_id는 세션 번호로 바뀜
+   * @return 세션이 없거나 멈춰 있거나, kReject 세션의 큐가 가득 차면 false
+   */
+  bool push(SessionId id, const FrameEnvelope& envelope);
+
+  bool session_stats(SessionId id, SessionStats* stats) const;
+  Stats stats() const;
+
+  void join(); // 모든 세션을 멈추고 작업 스레드 종료 대기
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  // 세션 실행 결과
+  enum class StepResult {
+    kIdle,    // 처리할 프레임 없음
+    kMore,    // 프레임을 처리했고 더 있을 수 있음
+    kBackoff, // 프레임 소스 읽기 실패 (잠시 뒤 다시 시도)
+    kEnded,   // 프레임 소스가 끝남 (세션을 멈추고 소스를 닫음)
+  };
+
+  struct Session {
+    Session(SessionId id, std::shared_ptr<TrackerManager> tracker, std::unique_ptr<FrameSource> source,
+            const SessionOptions& options);
+
+    StepResult step(); // 프레임 하나 처리 (작업 스레드, 한 번에 하나)
+    bool enqueue(const FrameEnvelope& envelope); // push() 큐에 넣기
+    bool dequeue(FrameEnvelope* envelope);
+    void clear_queue();
+    bool has_work(); // 실행할 프레임이 있는지 (큐 또는 실행 중인 소스)
+
+    const SessionId id;
+    const SessionOptions options;
+    const std::shared_ptr<TrackerManager> tracker;
+
+    std::atomic_bool running{false};
+    std::atomic_bool ended{false};     // 프레임 소스가 끝나 멈춤 (start_session()에서 해제)
+    std::atomic_bool scheduled{false}; // 작업 스레드 큐나 타이머에 들어 있거나 실행 중
+    std::atomic<std::size_t> last_worker{~std::size_t{0}}; // 마지막으로 실행한 작업 스레드
+    clock::time_point next_read;       // 다음에 소스를 읽을 시각 (fps 제한, 실행 중인 작업 스레드 전용)
+    std::atomic<std::int64_t> start_ns{0};
+
+    // push() 큐 (원형 버퍼)
+    std::mutex queue_mutex;
+    std::vector<FrameEnvelope> queue;
+    std::size_t queue_head = 0;
+    std::size_t queue_size = 0;
+
+    // 프레임 소스 (읽기는 작업 스레드, 열기/닫기는 start/stop을 호출한 스레드에서 하므로 source_mutex로 보호)
+    std::mutex source_mutex;
+    std::unique_ptr<FrameSource> source;
+    bool source_open = false;
+    cv::Mat read_buffer;
+    std::uint64_t sequence = 0;
+
+    // 변환 (작업 스레드 전용, 한 번에 하나)
+    FrameEnvelope input;
+    FrameEnvelope rgb_envelope;
+    BgrToRgbResizer converter;
+    cv::Mat converted;
+
+    std::atomic<std::uint64_t> received{0};
+    std::atomic<std::uint64_t> processed{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<std::uint64_t> tracker_rejected{0};
+    std::atomic<std::uint64_t> read_failures{0};
+    std::atomic<std::uint64_t> migrations{0};
+    std::atomic<std::int64_t> total_step_us{0};
+    std::atomic<std::int64_t> max_step_us{0};
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<Session>> sessions; // 실행할 세션 (앞: 자기 차례, 뒤: 다른 스레드가 가져감)
+    std::atomic<std::uint64_t> steps{0};
+    std::thread thread;
+  };
+
+  // 프레임 소스 읽기를 미룬 세션 (fps 제한, 읽기 실패)
+  struct Timer {
+    clock::time_point due;
+    std::shared_ptr<Session> session;
+  };
+
+  void run_impl(std::size_t index); // 작업 스레드 실행 로직
+  void run(std::size_t index, std::shared_ptr<Session> session);
+
+  // 세션을 작업 스레드 큐에 넣음 (이미 들어 있으면 무시)
+  void schedule(const std::shared_ptr<Session>& session, std::size_t index);
+  void enqueue(std::size_t index, std::shared_ptr<Session> session);
+  void defer(std::shared_ptr<Session> session, clock::time_point due);
+
+  std::shared_ptr<Session> pop_local(std::size_t index);
+  std::shared_ptr<Session> steal(std::size_t index);
+  void release_timers(std::size_t index); // 읽을 시각이 된 세션을 작업 스레드 큐 뒤로 옮김
+
+  std::shared_ptr<Session> find(SessionId id) const;
+
+  const Options options_;
+  const clock::time_point created_;
+
+  mutable std::mutex sessions_mutex_;
+  std::vector<std::shared_ptr<Session>> sessions_; // 세션 번호 → 세션 (제거되면 nullptr)
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<std::size_t> runnable_{0}; // 작업 스레드 큐에 있는 세션 수
+
+  std::mutex timer_mutex_;
+  std::vector<Timer> timers_;                 // due 순 최소 힙
+  std::atomic<std::int64_t> next_due_ns_{0};  // 가장 이른 due (없으면 0, timer_mutex_ 없이 확인용)
+
+  std::mutex idle_mutex_;                     // 대기 중인 작업 스레드 깨우기
+  std::condition_variable idle_cv_;
+  std::atomic<std::size_t> idle_{0};
+  std::atomic_bool stop_{false};
+
+  std::atomic<std::uint64_t> steals_{0};
+  std::atomic<std::uint64_t> idle_waits_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_SESSION_HOST_H_
@@ -0,0 +1,386 @@
+#include "shared_memory_frame.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace sample {
+
+constexpr std::uint32_t SharedMemoryFrameProducer::kDefaultSlotCount;
+constexpr std::uint32_t SharedMemoryFrameSource::kMinFreeSlots;
+
+namespace {
+
+constexpr char kMagic[4] = {'E', 'Y', 'S', 'F'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kBlockSize = 64;            // 헤더 크기 및 슬롯 정렬 단위
+constexpr std::uint32_t kWriting = 0x80000000u;   // 슬롯 state: 생산자가 쓰는 중
+
+inline std::uint64_t align_block(std::uint64_t size) {
+  return (size + kBlockSize - 1) & ~std::uint64_t{kBlockSize - 1};
+}
+
+} // namespace
+
+// 프로세스 사이에서 공유하는 구조체 (std::atomic은 lock-free일 때 주소에 무관하게 동작)
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "shared memory frames need lock-free atomics");
+
+struct SharedFrameHeader {
+  char magic[4];
+  std::uint32_t version;
+  std::int32_t rows;
+  std::int32_t cols;
+  std::int32_t type;
+  std::uint32_t slot_count;
+  std::uint64_t frame_bytes;
+  std::uint64_t slot_stride;
+  std::atomic<std::uint64_t> write_seq; // 마지막으로 공개한 프레임 번호 (1부터)
+};
+
+struct SharedFrameSlot {
+  std::atomic<std::uint64_t> seq;   // 슬롯에 담긴 프레임 번호 (0: 비어 있음)
+  std::atomic<std::uint32_t> state; // kWriting 비트 | 읽는 쪽 참조 수
+  std::uint32_t reserved;
+
+  std::uint8_t* pixels() { return reinterpret_cast<std::uint8_t*>(this) + kBlockSize; }
+};
+
+static_assert(sizeof(SharedFrameHeader) <= kBlockSize && sizeof(SharedFrameSlot) <= kBlockSize,
+              "shared frame headers must fit in one block");
+
+// 공유 메모리 매핑 (마지막 참조가 사라질 때 해제)
+struct SharedFrameMapping {
+  SharedFrameMapping(void* base, std::size_t length) : base(base), length(length) {}
+  ~SharedFrameMapping() {
+#if !defined(_WIN32)
+    ::munmap(base, length);
+#endif
+  }
+
+  SharedFrameHeader* header() const { return static_cast<SharedFrameHeader*>(base); }
+  SharedFrameSlot* slot(std::uint32_t i) const {
+    return reinterpret_cast<SharedFrameSlot*>(static_cast<std::uint8_t*>(base) + kBlockSize +
+                                              i * header()->slot_stride);
+  }
+
+  void* base;
+  std::size_t length;
+};
+
+namespace {
+
+#if !defined(_WIN32)
+std::shared_ptr<SharedFrameMapping> map_shared_memory(int fd, std::size_t length) {
+  void* base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd); // 매핑은 파일 디스크립터를 닫아도 유지됨
+  if (base == MAP_FAILED)
+    return nullptr;
+  return std::make_shared<SharedFrameMapping>(base, length);
+}
+#endif
+
+// read()가 반환한 cv::Mat이 참조하는 슬롯
+struct SlotPin {
+  std::shared_ptr<SharedFrameMapping> mapping; // 프레임이 남아 있는 동안 매핑 유지
+  SharedFrameSlot* slot;
+};
+
+/**
+ * SlotAllocator 클래스:
+ * - 공유 메모리 슬롯을 가리키는 cv::Mat에 참조 카운트를 붙이기 위한 OpenCV 할당자
+ * - 마지막 cv::Mat이 해제되면 deallocate()에서 슬롯 참조를 반환
+ * - 새 메모리를 할당하지는 않음 (cv::Mat::create로 크기가 바뀌면 기본 할당자가 사용됨)
+ */
+class SlotAllocator : public cv::MatAllocator {
+ public:
+  cv::UMatData* allocate(int, const int*, int, void*, std::size_t*, cv::AccessFlag,
+                         cv::UMatUsageFlags) const override {
+    return nullptr;
+  }
+
+  bool allocate(cv::UMatData*, cv::AccessFlag, cv::UMatUsageFlags) const override {
+    return false;
+  }
+
+  void deallocate(cv::UMatData* u) const override {
+    auto pin = static_cast<SlotPin*>(u->userdata);
+    pin->slot->state.fetch_sub(1, std::memory_order_release);
+    delete pin;
+    delete u;
+  }
+};
+
+const SlotAllocator slot_allocator;
+
+} // namespace
+
+// **SharedMemoryFrameProducer 클래스**
+SharedMemoryFrameProducer::SharedMemoryFrameProducer(std::string name, cv::Size size, int type,
+                                                     std::uint32_t slot_count)
+: name_(std::move(name)), size_(size), type_(type), slot_count_(std::max<std::uint32_t>(slot_count, 2)) {}
+
+SharedMemoryFrameProducer::~SharedMemoryFrameProducer() {
+  destroy();
+}
+
+bool SharedMemoryFrameProducer::create() {
+  destroy();
+#if defined(_WIN32)
+  return false;
+#else
+  if (size_.empty())
+    return false;
+
+  const std::uint64_t frame_bytes = static_cast<std::uint64_t>(size_.area()) * CV_ELEM_SIZE(type_);
+  const std::uint64_t slot_stride = kBlockSize + align_block(frame_bytes);
+  const std::size_t length = static_cast<std::size_t>(kBlockSize + slot_stride * slot_count_);
+
+  ::shm_unlink(name_.c_str()); // 이전 실행이 남긴 공유 메모리 제거
+  const int fd = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0)
+    return false;
+  if (::ftruncate(fd, static_cast<off_t>(length)) != 0) {
+    ::close(fd);
+    ::shm_unlink(name_.c_str());
+    return false;
+  }
+
+  mapping_ = map_shared_memory(fd, length);
+  if (!mapping_) {
+    ::shm_unlink(name_.c_str());
+    return false;
+  }
+
+  // ftruncate로 0으로 채워진 메모리에 헤더 작성 (magic은 마지막에 써서 완성된 헤더만 보이게 함)
+  auto header = mapping_->header();
+  header->version = kVersion;
+  header->rows = size_.height;
+  header->cols = size_.width;
+  header->type = type_;
+  header->slot_count = slot_count_;
+  header->frame_bytes = frame_bytes;
+  header->slot_stride = slot_stride;
+  header->write_seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header->magic, kMagic, sizeof(header->magic));
+
+  writing_ = nullptr;
+  next_ = 0;
+  seq_ = 0;
+  dropped_ = 0;
+  return true;
+#endif
+}
+
+void SharedMemoryFrameProducer::destroy() {
+  if (!mapping_)
+    return;
+#if !defined(_WIN32)
+  ::shm_unlink(name_.c_str());
+#endif
+  mapping_.reset();
+  writing_ = nullptr;
+}
+
+// 아무도 참조하지 않는 슬롯을 찾아 쓰기 중으로 표시
+// - 방금 공개한 슬롯은 읽는 쪽이 가져갈 수 있도록 건너뜀
+cv::Mat SharedMemoryFrameProducer::acquire() {
+  if (!mapping_)
+    return cv::Mat();
+  if (writing_ != nullptr) // 공개하지 않은 슬롯을 다시 사용
+    return cv::Mat(size_, type_, writing_->pixels());
+
+  for (std::uint32_t i = 0; i < slot_count_; ++i) {
+    auto slot = mapping_->slot((next_ + i) % slot_count_);
+    if (seq_ != 0 && slot->seq.load(std::memory_order_relaxed) == seq_)
+      continue;
+
+    std::uint32_t expected = 0;
+    if (slot->state.compare_exchange_strong(expected, kWriting, std::memory_order_acquire)) {
+      next_ = (next_ + i + 1) % slot_count_;
+      writing_ = slot;
+      return cv::Mat(size_, type_, slot->pixels());
+    }
+  }
+
+  ++dropped_; // 모든 슬롯이 참조 중
+  return cv::Mat();
+}
+
+void SharedMemoryFrameProducer::publish() {
+  if (writing_ == nullptr)
+    return;
+
+  writing_->seq.store(++seq_, std::memory_order_relaxed);
+  writing_->state.store(0, std::memory_order_release); // 픽셀과 seq를 공개
+  mapping_->header()->write_seq.store(seq_, std::memory_order_release);
+  writing_ = nullptr;
+}
+
+bool SharedMemoryFrameProducer::write(const cv::Mat& frame) {
+  if (frame.size() != size_ || frame.type() != type_)
+    return false;
+
+  cv::Mat slot = acquire();
+  if (slot.empty())
+    return false;
+  frame.copyTo(slot);
+  publish();
+  return true;
+}
+
+// **SharedMemoryFrameSource 클래스**
+SharedMemoryFrameSource::~SharedMemoryFrameSource() {
+  close();
+}
+
+bool SharedMemoryFrameSource::open() {
+  close();
+#if defined(_WIN32)
+  return false;
+#else
+  const int fd = ::shm_open(name_.c_str(), O_RDWR, 0);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < kBlockSize) {
+    ::close(fd);
+    return false;
+  }
+
+  auto mapping = map_shared_memory(fd, static_cast<std::size_t>(st.st_size));
+  if (!mapping)
+    return false;
+
+  const auto header = mapping->header();
+  if (std::memcmp(header->magic, kMagic, sizeof(header->magic)) != 0)
+    return false; // 생산자가 아직 헤더를 쓰지 않았거나 다른 형식
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (header->version != kVersion || header->slot_count == 0 ||
+      kBlockSize + header->slot_stride * header->slot_count > mapping->length)
+    return false;
+
+  mapping_ = std::move(mapping);
+  last_seq_ = 0;
+  skipped_ = 0;
+  return true;
+#endif
+}
+
+// 이미 내보낸 프레임은 cv::Mat이 해제될 때까지 매핑이 유지됨
+void SharedMemoryFrameSource::close() {
+  mapping_.reset();
+}
+
+// 공개된 프레임이 바뀔 때까지 짧게 쉬면서 확인 (프로세스 사이의 알림 수단이 없으므로 폴링)
+bool SharedMemoryFrameSource::read(cv::Mat& frame) {
+  if (!mapping_)
+    return false;
+
+  // 풀 버퍼가 이전에 내보낸 슬롯을 가리키고 있으면 먼저 반환 (다른 참조가 없으면 생산자가 다시 씀)
+  if (frame.u != nullptr && frame.u->currAllocator == &slot_allocator)
+    frame.release();
+
+  const auto header = mapping_->header();
+  const auto deadline = std::chrono::steady_clock::now() + timeout_;
+  SharedFrameSlot* slot = nullptr;
+  while ((slot = pin_latest()) == nullptr) {
+    if (std::chrono::steady_clock::now() >= deadline)
+      return false;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  const auto seq = slot->seq.load(std::memory_order_relaxed);
+  skipped_ += seq - last_seq_ - 1;
+  last_seq_ = seq;
+
+  cv::Mat view(header->rows, header->cols, header->type, slot->pixels());
+
+  // 이 슬롯까지 묶으면 생산자가 쓸 슬롯이 모자라므로 복사하고 슬롯은 바로 반환
+  // (풀/링/소비자가 프레임을 오래 보관해도 생산자가 멈추지 않도록 함)
+  if (free_slots(slot) < kMinFreeSlots) {
+    view.copyTo(frame); // 크기가 같으면 재할당 없음
+    slot->state.fetch_sub(1, std::memory_order_release);
+    ++copied_;
+    return true;
+  }
+
+  auto u = new cv::UMatData(&slot_allocator);
+  u->data = u->origdata = slot->pixels();
+  u->size = static_cast<std::size_t>(header->frame_bytes);
+  u->userdata = new SlotPin{mapping_, slot};
+  u->refcount = 1;
+  view.u = u; // 이제 view가 슬롯 참조를 소유함
+
+  frame = view;
+  return true;
+}
+
+// 쓰는 중도 아니고 읽는 쪽 참조도 없는 슬롯 수 (except 제외, 생산자와 동시에 바뀌므로 근삿값)
+std::uint32_t SharedMemoryFrameSource::free_slots(const SharedFrameSlot* except) const {
+  const auto header = mapping_->header();
+  std::uint32_t count = 0;
+  for (std::uint32_t i = 0; i < header->slot_count; ++i) {
+    const auto slot = mapping_->slot(i);
+    if (slot != except && slot->state.load(std::memory_order_relaxed) == 0)
+      ++count;
+  }
+  return count;
+}
+
+bool SharedMemoryFrameSource::skip() {
+  if (!mapping_)
+    return false;
+  const auto seq = mapping_->header()->write_seq.load(std::memory_order_acquire);
+  if (seq <= last_seq_)
+    return false;
+  skipped_ += seq - last_seq_;
+  last_seq_ = seq;
+  return true;
+}
+
+// 쓰는 중이 아닌 슬롯 중 last_seq_보다 새로운 가장 최신 프레임의 참조 수를 늘림
+// - 참조를 얻은 뒤 다시 확인하여 그 사이 덮어쓰인 경우에도 일관된(더 새로운) 프레임만 사용
+SharedFrameSlot* SharedMemoryFrameSource::pin_latest() {
+  const auto header = mapping_->header();
+  if (header->write_seq.load(std::memory_order_acquire) <= last_seq_)
+    return nullptr;
+
+  for (;;) {
+    SharedFrameSlot* best = nullptr;
+    std::uint64_t best_seq = last_seq_;
+    for (std::uint32_t i = 0; i < header->slot_count; ++i) {
+      auto slot = mapping_->slot(i);
+      const auto seq = slot->seq.load(std::memory_order_relaxed);
+      if (seq > best_seq && (slot->state.load(std::memory_order_relaxed) & kWriting) == 0) {
+        best = slot;
+        best_seq = seq;
+      }
+    }
+    if (best == nullptr)
+      return nullptr;
+
+    auto state = best->state.load(std::memory_order_relaxed);
+    while ((state & kWriting) == 0) {
+      if (best->state.compare_exchange_weak(state, state + 1, std::memory_order_acquire)) {
+        if (best->seq.load(std::memory_order_relaxed) > last_seq_)
+          return best;
+        best->state.fetch_sub(1, std::memory_order_release); // 이미 읽은 프레임으로 덮어쓰임
+        break;
+      }
+    }
+    // 쓰는 중으로 바뀌었으면 다시 탐색
+  }
+}
+
+} // namespace sample
@@ -0,0 +1,137 @@
+#ifndef EYEDID_CPP_SAMPLE_SHARED_MEMORY_FRAME_H_
+#define EYEDID_CPP_SAMPLE_SHARED_MEMORY_FRAME_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "frame_pool.h"
+#include "frame_source.h"
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * 공유 메모리 프레임 링 (POSIX shm_open)
+ *
+ *   [SharedFrameHeader (64바이트)]
+ *   [SharedFrameSlot 헤더 (64바이트)][픽셀] * slot_count  (각 슬롯은 64바이트 경계)
+ *
+ * - 다른 프로세스가 SharedMemoryFrameProducer로 프레임을 쓰고, SharedMemoryFrameSource로 읽음
+ * - 각 슬롯의 state는 읽는 쪽 참조 수와 쓰기 중 비트로 구성되며,
+ *   생산자는 아무도 참조하지 않는 슬롯에만 씀 (참조 중인 슬롯은 건너뛰고, 모두 참조 중이면 프레임을 버림)
+ * - 읽는 쪽은 슬롯을 가리키는 cv::Mat을 내보내고 마지막 참조가 해제될 때 슬롯을 반환하므로,
+ *   슬롯 개수는 읽는 쪽 FramePool 크기(FrameRing 슬롯 + 처리 중인 프레임)보다 넉넉해야 복사가 없음
+ * - 같은 기기에서 같은 빌드끼리 사용하는 것을 전제로 함 (구조체를 그대로 공유)
+ * - Windows에서는 지원하지 않음 (create()/open()이 false 반환)
+ */
+struct SharedFrameHeader;
+struct SharedFrameSlot;
+struct SharedFrameMapping;
+
+/**
+ * SharedMemoryFrameProducer 클래스:
+ * - 공유 메모리 프레임 링을 만들고 프레임을 씀 (생산자 프로세스에서 사용, 한 스레드에서만 호출)
+ * - acquire()로 슬롯을 직접 가리키는 cv::Mat을 받아 그 위에 그리면 생산자 쪽 복사도 없음
+ */
+class SharedMemoryFrameProducer {
+ public:
+  // 읽는 쪽 FramePool 버퍼가 모두 슬롯을 참조하고 생산자가 한 슬롯에 쓰는 중이어도
+  // SharedMemoryFrameSource::kMinFreeSlots개가 남는 개수 (풀 버퍼 + 쓰는 중 1 + kMinFreeSlots)
+  static constexpr std::uint32_t kDefaultSlotCount = FramePool::kDefaultDepth + 1 + 2;
+
+  /**
+   * @param name       공유 메모리 이름 (예: "/eyedid-frames")
+   * @param size       프레임 크기
+   * @param type       OpenCV 타입 (예: CV_8UC3)
+   * @param slot_count 슬롯 개수 (최소 2)
+   */
+  SharedMemoryFrameProducer(std::string name, cv::Size size, int type = CV_8UC3,
+                            std::uint32_t slot_count = kDefaultSlotCount);
+  ~SharedMemoryFrameProducer();
+
+  SharedMemoryFrameProducer(const SharedMemoryFrameProducer&) = delete;
+  SharedMemoryFrameProducer& operator=(const SharedMemoryFrameProducer&) = delete;
+
+  bool create();  // 공유 메모리 생성 (같은 이름이 있으면 새로 만듦)
+  void destroy(); // 매핑 해제 및 공유 메모리 삭제 (읽는 쪽 매핑은 닫을 때까지 유지됨)
+
+  /**
+   * 쓸 슬롯을 가져옴
+   * @return 슬롯의 픽셀 메모리를 가리키는 cv::Mat, 모든 슬롯이 참조 중이면 빈 cv::Mat (dropped 증가)
+   */
+  cv::Mat acquire();
+
+  // acquire()로 얻은 슬롯을 읽는 쪽에 공개
+  void publish();
+
+  // 프레임을 복사하여 쓰기 (acquire() + copyTo() + publish())
+  bool write(const cv::Mat& frame);
+
+  std::uint64_t published() const { return seq_; }
+  std::uint64_t dropped() const { return dropped_; }
+
+ private:
+  std::string name_;
+  cv::Size size_;
+  int type_;
+  std::uint32_t slot_count_;
+
+  std::shared_ptr<SharedFrameMapping> mapping_;
+  SharedFrameSlot* writing_ = nullptr; // acquire()로 잡은 슬롯
+  std::uint32_t next_ = 0;             // 다음에 확인할 슬롯
+  std::uint64_t seq_ = 0;              // 공개한 프레임 수
+  std::uint64_t dropped_ = 0;
+};
+
+/**
+ * SharedMemoryFrameSource 클래스:
+ * - 다른 프로세스가 쓰는 공유 메모리 프레임 링을 프레임 소스로 사용
+ * - read()는 가장 최신 프레임의 슬롯을 가리키는 cv::Mat을 frame에 넣으므로 픽셀 복사가 없음
+ *   - 슬롯 참조는 cv::Mat 참조 카운트로 관리되어, 마지막 cv::Mat이 해제될 때 생산자에게 반환됨
+ *     (FramePool 버퍼도 참조를 가지므로, 다음 read()에서 그 버퍼를 다시 쓸 때 반환됨)
+ *   - 그 슬롯을 참조하면 생산자가 쓸 수 있는 슬롯이 kMinFreeSlots개보다 적어지는 경우에만
+ *     frame 버퍼로 복사하고 슬롯을 바로 반환 (copied() 증가)
+ * - FramePool 통계에서는 슬롯이 바뀔 때마다 miss로 기록됨 (메모리 할당은 없음)
+ * - 생산자가 밀린 프레임은 건너뛰고 항상 최신 프레임을 읽음
+ */
+class SharedMemoryFrameSource : public FrameSource {
+ public:
+  static constexpr std::uint32_t kMinFreeSlots = 2; // 생산자에게 남겨 둘 슬롯 수 (쓸 슬롯 + 다음 최신 프레임)
+
+  /**
+   * @param name    공유 메모리 이름
+   * @param timeout 새 프레임을 기다릴 최대 시간 (초과하면 read()가 false 반환)
+   */
+  explicit SharedMemoryFrameSource(std::string name,
+                                   std::chrono::milliseconds timeout = std::chrono::milliseconds(100))
+  : name_(std::move(name)), timeout_(timeout) {}
+  ~SharedMemoryFrameSource() override;
+
+  bool open() override;
+  void close() override;
+  bool read(cv::Mat& frame) override;
+  bool skip() override; // 현재까지 공개된 프레임을 모두 읽은 것으로 처리
+
+  std::string name() const override { return "shared memory " + name_; }
+
+  std::uint64_t skipped() const { return skipped_; } // 읽기 전에 덮어쓰인(건너뛴) 프레임 수
+  std::uint64_t copied() const { return copied_; }   // 슬롯이 모자라 복사한 프레임 수
+
+ private:
+  SharedFrameSlot* pin_latest(); // 가장 최신 슬롯의 참조 수 증가
+  std::uint32_t free_slots(const SharedFrameSlot* except) const; // 아무도 참조하지 않는 슬롯 수
+
+  std::string name_;
+  std::chrono::milliseconds timeout_;
+  std::shared_ptr<SharedFrameMapping> mapping_;
+  std::uint64_t last_seq_ = 0;
+  std::uint64_t skipped_ = 0;
+  std::uint64_t copied_ = 0;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_SHARED_MEMORY_FRAME_H_
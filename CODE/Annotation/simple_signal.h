@@ -1,10 +1,21 @@
 #ifndef EYEDID_CPP_SAMPLE_SIMPLE_SIGNAL_H_
 #define EYEDID_CPP_SAMPLE_SIMPLE_SIGNAL_H_
 
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "delegate.h"
+#include "executor.h"
+#include "mpsc_queue.h"
 
 namespace sample {
 
@@ -16,24 +27,239 @@ namespace sample {
 template<typename F>
 class signal;
 
+// ñ׳   ⺻ Ŭ
+// -    ñ׳  迭   ϴ  
+// - synchronize(): ȣ  ٲ ( ü  ǥ)     ȣ    
+class signal_state_base {
+ public:
+  virtual ~signal_state_base() = default;
+  virtual void compact() = 0;
+  virtual void synchronize() = 0;
+};
+
+namespace detail {
+
+//  忡   ȣ  (庰  Ʈ,   )
+// -  ü ڱ⸦ ȣϴ  ȿ   ڱ ȣ ٸ ʵ 
+struct call_record {
+  const void* owner = nullptr; // ȣ  ñ׳  Ǵ  
+  unsigned phase = 0;          // ñ׳ : ȣ  ī ȣ
+  call_record* next = nullptr;
+};
+
+inline call_record*& call_stack() {
+  static thread_local call_record* top = nullptr;
+  return top;
+}
+
+//  尡 owner phase īͿ    ȣ 
+inline std::size_t own_calls(const void* owner, unsigned phase) {
+  std::size_t count = 0;
+  for (auto record = call_stack(); record != nullptr; record = record->next) {
+    if (record->owner == owner && record->phase == phase)
+      ++count;
+  }
+  return count;
+}
+
+/**
+ * tracking_block Ŭ: trackable ü  ǥ (  )
+ * -   alive() б⸸ ϹǷ ȣ⸶  īƮ ٲ 
+ * - expire()  ǥø  , ǥø   ȣ     
+ *   -  ȣ:   ñ׳ synchronize()
+ *   - queued connection: ⿡ ȣ  (pins_) 0  
+ */
+class tracking_block {
+ public:
+  //   ( )
+  // -  ϰ б: ñ׳ ȣ   ڿ о synchronize()  ȣ ġ  (x86 Ϲ б )
+  bool alive() const { return alive_.load(); }
+
+  //  ȣ ñ׳  (connect)
+  void watch(std::weak_ptr<signal_state_base> state) {
+    std::lock_guard<std::mutex> lck(mutex_);
+    states_.erase(std::remove_if(states_.begin(), states_.end(),
+                                 [](const std::weak_ptr<signal_state_base>& w) { return w.expired(); }),
+                  states_.end());
+    states_.push_back(std::move(state));
+  }
+
+  // ⿡ ȣϴ    (   false)
+  bool pin(call_record* record) {
+    pins_.fetch_add(1);
+    if (!alive_.load()) {
+      pins_.fetch_sub(1);
+      return false;
+    }
+    record->owner = this;
+    record->next = call_stack();
+    call_stack() = record;
+    return true;
+  }
+
+  void unpin(call_record* record) {
+    call_stack() = record->next;
+    pins_.fetch_sub(1);
+  }
+
+  //  ǥø    ȣ    (ó  )
+  void expire() {
+    if (!alive_.exchange(false))
+      return;
+
+    std::vector<std::weak_ptr<signal_state_base>> states;
+    {
+      std::lock_guard<std::mutex> lck(mutex_);
+      states.swap(states_);
+    }
+    for (const auto& w : states) {
+      if (auto state = w.lock())
+        state->synchronize();
+    }
+    while (pins_.load() > own_calls(this, 0))
+      std::this_thread::yield();
+  }
+
+ private:
+  std::atomic_bool alive_{true};
+  std::atomic_size_t pins_{0}; // ⿡ ȣ  
+  std::mutex mutex_;           // states_ ȣ
+  std::vector<std::weak_ptr<signal_state_base>> states_; //  ȣ   ñ׳
+};
+
+} // namespace detail
+
+/**
+ * trackable Ŭ:    ִ ü ⺻ Ŭ
+ * - connect(func, std::shared_ptr<T>) T trackable̸  weak_ptr   ǥ÷ Ḧ Ȯ
+ *   (ึ weak_ptr::lock  īƮ  )
+ * - Ҹϸ    ̻ ȣ , ̹ ȣ     ٸ
+ * - Ļ Ŭ Ҹ ó expire_connections() ȣؾ 
+ *   (⺻ Ŭ Ҹڴ Ļ Ŭ   ڿ ǹǷ)
+ * -  ñ׳  ȿ  尡 ÿ  ٸ trackable ϸ θ ٸǷ ؾ 
+ */
+class trackable {
+ public:
+  trackable() : block_(std::make_shared<detail::tracking_block>()) {}
+  trackable(const trackable&) : trackable() {} // 纻   
+  trackable& operator=(const trackable&) { return *this; }
+  ~trackable() { block_->expire(); }
+
+ protected:
+  //   ȣ ߰   ȣ    (  ȣص )
+  void expire_connections() { block_->expire(); }
+
+ private:
+  template<typename F> friend class signal;
+
+  std::shared_ptr<detail::tracking_block> block_;
+};
+
+// queued connection ⺻ Ŭ (Ằ  ȸ)
+class queued_slot_base {
+ public:
+  virtual ~queued_slot_base() = default;
+
+  // ť    ȣ  (kAll å)
+  std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  std::atomic<std::uint64_t> dropped_{0};
+};
+
 // ̺Ʈ  ⺻ Ŭ
 class slot_base {
  public:
   ~slot_base() = default;
   virtual void expire() = 0;
+
+  // queued connection̸     ( ȸ)
+  void set_queued(std::shared_ptr<const queued_slot_base> queued) { queued_ = std::move(queued); }
+
+  // ť    ȣ  (queued connection ƴϸ 0)
+  std::uint64_t dropped() const { return queued_ ? queued_->dropped() : 0; }
+
+ private:
+  std::shared_ptr<const queued_slot_base> queued_;
+};
+
+// ⿡  ȣϴ   ü ϴ RAII ü (slot::acquire())
+class track_pin {
+ public:
+  track_pin() = default;
+  ~track_pin() {
+    if (block_ != nullptr)
+      block_->unpin(&record_);
+  }
+
+  track_pin(const track_pin&) = delete;
+  track_pin& operator=(const track_pin&) = delete;
+
+ private:
+  template<typename R, typename ...Args> friend class slot;
+
+  std::shared_ptr<void> object_;               // weak_ptr ϴ ü
+  detail::tracking_block* block_ = nullptr;    // trackable ü  ǥ
+  detail::call_record record_;
 };
 
 // ̺Ʈ  ϴ Ŭ ø
+// -  ü ϰ ϹǷ   ø 
+//   (   ü ϰų ü ڱ   ־ ü  )
+// - trackable ü: ȣ   ǥø   б⸸  ( trackable   ȣ ٸ)
+// -   ü: ȣ  weak_ptr::lock  ξ ȣ ߿  
+// -  ü     Ȯϸ  · ٲ  ȣ ٷ ǳʶ
 template<typename R, typename ...Args>
 class slot : public slot_base {
  public:
   template<typename F2>
-  explicit slot(const F2& func) : func_(func) {} // Կ Լ 
+  explicit slot(F2&& func, std::shared_ptr<void> track = nullptr)
+    : func_(std::forward<F2>(func)), track_(track), tracked_(track != nullptr) {} // Կ Լ 
+
+  template<typename F2>
+  slot(F2&& func, std::shared_ptr<detail::tracking_block> block)
+    : func_(std::forward<F2>(func)), block_(std::move(block)), tracked_(false) {}
 
-  //  ȣ   Լ
+  //  ȣ (Ǿų  ü  ȣ ʰ false ȯ)
   template<typename ...Ts>
-  R operator()(Ts&&... args) const {
-    return func_(std::forward<Ts>(args)...); // ϵ Լ 
+  bool call(Ts&&... args) const {
+    if (expired_.load(std::memory_order_relaxed))
+      return false;
+    if (block_ != nullptr) {
+      if (!block_->alive()) {
+        expired_.store(true, std::memory_order_relaxed); //  ü 
+        return false;
+      }
+      func_(std::forward<Ts>(args)...);
+      return true;
+    }
+
+    std::shared_ptr<void> hold; // ȣϴ   ü 
+    if (tracked_) {
+      hold = track_.lock();
+      if (!hold) {
+        expired_.store(true, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    func_(std::forward<Ts>(args)...); // ϵ Լ 
+    return true;
+  }
+
+  // ⿡ ȣ  ִ Ȯϰ, pin Ҹ   ü 
+  bool acquire(track_pin* pin) const {
+    if (expired_.load(std::memory_order_relaxed))
+      return false;
+    if (block_ != nullptr) {
+      if (!block_->pin(&pin->record_))
+        return false;
+      pin->block_ = block_.get();
+    } else if (tracked_) {
+      pin->object_ = track_.lock();
+      if (!pin->object_)
+        return false;
+    }
+    return true;
   }
 
   void expire() override {
@@ -41,12 +267,116 @@ class slot : public slot_base {
   }
 
   bool expired() const {
-    return expired_; //  Ǿ Ȯ
+    //  Ǿų  ü  Ȯ
+    return expired_ || (block_ != nullptr && !block_->alive()) || (tracked_ && track_.expired());
   }
 
  private:
-  std::atomic_bool expired_{false}; //   θ Ÿ
-  std::function<R(Args...)> func_; // Կ  Լ
+  mutable std::atomic_bool expired_{false}; //   θ Ÿ
+  delegate<R(Args...)> func_; // Կ  Լ
+  std::shared_ptr<detail::tracking_block> block_; // trackable ü  ǥ
+  std::weak_ptr<void> track_; // trackable ƴ  ü ( )
+  const bool tracked_; // track_ ִ
+};
+
+//  ѱ  ȣ  å
+enum class queue_policy {
+  kAll,    //  ȣ   (ť    ȣ )
+  kLatest, //    ȣ  ȣ  (: ü ġ)
+};
+
+/**
+ * queued_slot Ŭ:  ȣ ⿡  (queued connection)
+ * -   ڸ  ť ְ ٷ ȯ
+ * - ⿡ ó ۾   ϳ ǹǷ ȣ  
+ * -     ִ ȣ  
+ * - kAll å ť    ȣ  connection::dropped() Ȯ
+ */
+template<typename ...Args>
+class queued_slot : public queued_slot_base, public std::enable_shared_from_this<queued_slot<Args...>> {
+ public:
+  using function_type = delegate<void(Args...)>;
+  using args_type = std::tuple<typename std::decay<Args>::type...>;
+
+  queued_slot(function_type func, Executor& executor, queue_policy policy, std::size_t capacity)
+    : func_(std::move(func)), executor_(executor), policy_(policy),
+      queue_(policy == queue_policy::kAll ? capacity : 2) {}
+
+  //  θ Ȯ ñ׳   
+  void set_owner(std::weak_ptr<slot<void, Args...>> owner) {
+    owner_ = std::move(owner);
+  }
+
+  // ȣ ڸ ְ, ó ۾ Ǿ   ⿡  ( )
+  void push(Args... args) {
+    if (policy_ == queue_policy::kLatest) {
+      std::lock_guard<std::mutex> lck(latest_mutex_);
+      latest_ = args_type(std::forward<Args>(args)...);
+      has_latest_ = true;
+    } else if (!queue_.try_push(args_type(std::forward<Args>(args)...))) {
+      dropped_.fetch_add(1, std::memory_order_relaxed); // ť  : Һڰ  ϴ ȣ 
+      return;
+    }
+
+    if (pending_.fetch_add(1) == 0) {
+      auto self = this->shared_from_this();
+      executor_.post([self]() {
+        self->drain();
+      });
+    }
+  }
+
+ private:
+  //  ȣ ó ()
+  // - pending_ 0   óϹǷ ó ۾ ÿ ϳ 
+  void drain() {
+    const auto owner = owner_.lock();
+    std::size_t count = pending_.load();
+    do {
+      if (policy_ == queue_policy::kLatest) {
+        args_type args;
+        bool has_args = false;
+        {
+          std::lock_guard<std::mutex> lck(latest_mutex_);
+          std::swap(has_args, has_latest_);
+          if (has_args)
+            std::swap(args, latest_);
+        }
+        if (has_args)
+          invoke(owner, args);
+      } else {
+        for (std::size_t i = 0; i < count; ++i) {
+          args_type args;
+          while (!queue_.try_pop(&args))
+            std::this_thread::yield(); //  ĭ ä ڸ ٸ
+          invoke(owner, args);
+        }
+      }
+      count = pending_.fetch_sub(count) - count; // óϴ   ȣ 
+    } while (count != 0);
+  }
+
+  //  ų  ü  ȣ  (ȣϴ   ü )
+  void invoke(const std::shared_ptr<slot<void, Args...>>& owner, args_type& args) {
+    track_pin pin;
+    if (owner && owner->acquire(&pin))
+      invoke(args, std::index_sequence_for<Args...>());
+  }
+
+  template<std::size_t ...I>
+  void invoke(args_type& args, std::index_sequence<I...>) {
+    func_(std::get<I>(args)...);
+  }
+
+  function_type func_;                    // ⿡ ȣ Լ
+  Executor& executor_;                    // ȣ  
+  const queue_policy policy_;             //  å
+  MpscQueue<args_type> queue_;            // kAll: ȣ  ť
+  std::mutex latest_mutex_;               // kLatest:  ȣ  ȣ
+  args_type latest_;                      // kLatest:  ȣ 
+  bool has_latest_ = false;               // kLatest:  ó  ȣ 
+  std::atomic_size_t pending_{0};         // ó  ȣ 
+  std::weak_ptr<slot<void, Args...>> owner_; // ñ׳   (  Ȯο)
 };
 
 /**
@@ -62,23 +392,29 @@ class connection {
     auto lock_ptr = slot_ptr_.lock(); //  ͸ 
     if (lock_ptr) {
       lock_ptr->expire(); //   · 
+
+      auto state_ptr = state_ptr_.lock();
+      if (state_ptr)
+        state_ptr->compact(); // ñ׳  迭 
     }
   }
 
+  // queued connection ť    ȣ  (queued connection ƴϰų  Ǿ 0)
+  std::uint64_t dropped() const {
+    auto lock_ptr = slot_ptr_.lock();
+    return lock_ptr ? lock_ptr->dropped() : 0;
+  }
+
  private:
   template<typename F> friend class signal;
 
   //  ͸ ʱȭϴ 
   template<typename ...T>
-  explicit connection(std::shared_ptr<slot<T...>> ptr) : slot_ptr_(std::move(ptr)) {}
-
-  template<typename ...T>
-  connection& operator=(std::shared_ptr<slot<T...>> ptr) {
-    slot_ptr_ = std::move(ptr); //  ͸ ü
-    return *this;
-  }
+  connection(std::shared_ptr<slot<T...>> ptr, std::weak_ptr<signal_state_base> state)
+    : slot_ptr_(std::move(ptr)), state_ptr_(std::move(state)) {}
 
   std::weak_ptr<slot_base> slot_ptr_; //   
+  std::weak_ptr<signal_state_base> state_ptr_; // ñ׳    
 };
 
 /**
@@ -102,6 +438,9 @@ class raii_connection {
     conn_ = std::move(conn); //   
     return *this;
   }
+
+  std::uint64_t dropped() const { return conn_.dropped(); } // connection::dropped()
+
  private:
   connection conn_; //  ü
 };
@@ -109,6 +448,10 @@ class raii_connection {
 /**
  * signal Ŭ: ̺Ʈ  ˸ ó
  * - ϵ Լ() ȣ  ִ ̺Ʈ ý
+ * -        üϴ  迭 (copy-on-write)
+ * - ȣ(operator())    迭 ȸϹǷ   (wait-free)
+ * - connect/disconnect mutex ȭǸ, ̶   迭 
+ * - ü 迭   ȣ  (ü  Ǵ  ȣ  ) 
  *
  * @tparam R    Լ ȯ Ÿ
  * @tparam Args Լ  Ÿ
@@ -116,9 +459,16 @@ class raii_connection {
 template<typename R, typename ...Args>
 class signal<R(Args...)> {
  public:
-  using function_type = std::function<R(Args...)>; // Լ Ÿ 
+  using function_type = delegate<R(Args...)>; // Լ Ÿ  (̵ )
   using slot_type = slot<R, Args...>; //  Ÿ 
-  using slot_list = std::list<std::shared_ptr<slot_type>>; //  Ʈ
+  using slot_array = std::vector<std::shared_ptr<slot_type>>; //  迭 ( ڿ  )
+
+  static constexpr std::size_t kDefaultQueueCapacity = 64; // queued connection ⺻ ť ũ
+
+  signal() = default;
+
+  signal(const signal&) = delete;
+  signal& operator=(const signal&) = delete;
 
   /**
    * Լ 
@@ -127,18 +477,14 @@ class signal<R(Args...)> {
    * @return  ü(connection)
    */
   connection connect(function_type func) {
-    auto new_slot = std::make_shared<slot_type>(std::move(func));
-    {
-      std::lock_guard<std::mutex> lck(connect_mutex_); // Ʈ ȣ
-      slot_list_.emplace_back(new_slot); //  ߰
-    }
-
-    return connection(new_slot); //  ü ȯ
+    return add(std::make_shared<slot_type>(std::move(func)));
   }
 
   /**
    * Լ  ü 
    * -  ü   Լ ȣ 
+   * - T trackable̸ ȣ⸶  ǥø Ȯ (,    ü  ԰  )
+   * -   ü ϰ ϸ, ȣϴ ȸ  
    *
    * @tparam T     ü Ÿ
    * @param func   Լ
@@ -147,45 +493,264 @@ class signal<R(Args...)> {
    */
   template<typename T>
   connection connect(function_type func, std::shared_ptr<T> track) {
-    std::weak_ptr<void> weak_ptr = std::move(track); //  ü 
-    return connect([=](Args&&... args) {
-      auto lck = weak_ptr.lock(); //  ü 
-      if (lck) {
-        func(std::forward<Args>(args)...); //  ü ȿϸ Լ 
-      }
-    });
+    return add_tracked(std::move(func), std::move(track), std::is_base_of<trackable, T>());
+  }
+
+  /**
+   * Լ ⿡  (queued connection)
+   * - ñ׳ Ǹ ڸ  ΰ, Լ ⿡ ȣ
+   * -  Լ  (: SDK  )  
+   * -  Ẹ  Ǿ 
+   *
+   * @param func      Լ
+   * @param executor Լ  
+   * @param policy   Ǳ   ȣ  å
+   * @param capacity kAll å ׾   ִ ִ ȣ 
+   * @return  ü(connection)
+   */
+  connection connect(function_type func, Executor& executor,
+                     queue_policy policy = queue_policy::kAll,
+                     std::size_t capacity = kDefaultQueueCapacity) {
+    return add_queued(std::move(func), tracked_target(), executor, policy, capacity);
+  }
+
+  /**
+   * Լ  ü ⿡  (queued connection)
+   * -  ü  ⿡ Լ ȣ  Ȯ
+   */
+  template<typename T>
+  connection connect(function_type func, std::shared_ptr<T> track, Executor& executor,
+                     queue_policy policy = queue_policy::kAll,
+                     std::size_t capacity = kDefaultQueueCapacity) {
+    return add_queued(std::move(func), track_of(std::move(track), std::is_base_of<trackable, T>()),
+                      executor, policy, capacity);
   }
 
   /**
    *  Լ ȣ
-   * -   Ʈ ȸϸ Լ ȣ
+   * -   迭   ȸϸ Լ ȣ
    *
    * @tparam Args2 ȣ⿡   Ÿ
    * @param args   ȣ⿡  
    */
   template<typename ...Args2>
   void operator()(Args2&&... args) {
-    std::unique_lock<std::mutex> lck(connect_mutex_); // Ʈ ȣ
-    auto it = slot_list_.begin();
+    state_->emit(args...);
+  }
+
+  //    (    )
+  std::size_t slot_count() const {
+    return state_->slot_count();
+  }
+
+ private:
+  connection add(std::shared_ptr<slot_type> new_slot) {
+    state_->add(new_slot); //  ߰
+    return connection(new_slot, state_); //  ü ȯ
+  }
+
+  // trackable ü:  ǥ÷ Ȯϰ,    ñ׳   ȣ ٸ 
+  template<typename T>
+  connection add_tracked(function_type func, std::shared_ptr<T> track, std::true_type) {
+    auto block = static_cast<const trackable&>(*track).block_;
+    block->watch(state_);
+    return add(std::make_shared<slot_type>(std::move(func), std::move(block)));
+  }
+
+  template<typename T>
+  connection add_tracked(function_type func, std::shared_ptr<T> track, std::false_type) {
+    return add(std::make_shared<slot_type>(std::move(func), std::shared_ptr<void>(std::move(track))));
+  }
+
+  // queued connection   (trackable̸  ǥ)
+  struct tracked_target {
+    std::shared_ptr<void> object;
+    std::shared_ptr<detail::tracking_block> block;
+  };
+
+  template<typename T>
+  static tracked_target track_of(std::shared_ptr<T> track, std::true_type) {
+    return { nullptr, static_cast<const trackable&>(*track).block_ };
+  }
+
+  template<typename T>
+  static tracked_target track_of(std::shared_ptr<T> track, std::false_type) {
+    return { std::move(track), nullptr };
+  }
+
+  //  忡 ڸ ť ֱ⸸ ϴ  ߰
+  // -  ü ñ׳   ϰ ϸ, ⿡ ȣ  ٽ   θ Ȯ
+  // -   Լ ڸ ť ֱ⸸ ϹǷ trackable synchronize()   
+  connection add_queued(function_type func, tracked_target track, Executor& executor,
+                        queue_policy policy, std::size_t capacity) {
+    static_assert(std::is_void<R>::value, "queued connection requires a void return type");
+    auto queued = std::make_shared<queued_slot<Args...>>(std::move(func), executor, policy, capacity);
+    auto forward = [queued](Args... args) {
+      queued->push(std::forward<Args>(args)...);
+    };
+    auto new_slot = track.block != nullptr
+        ? std::make_shared<slot_type>(std::move(forward), std::move(track.block))
+        : std::make_shared<slot_type>(std::move(forward), std::move(track.object));
+    queued->set_owner(new_slot);
+    new_slot->set_queued(queued);
+    return add(std::move(new_slot));
+  }
 
-    while (it != slot_list_.end()) {
-      if ((*it)->expired()) { //   
-        it = slot_list_.erase(it);
-        continue;
+  // ñ׳  
+  // - connection  ͷ ϹǷ ñ׳κ    
+  class state : public signal_state_base {
+   public:
+    ~state() override {
+      delete slots_.load();
+      for (auto slots : retired_)
+        delete slots;
+    }
+
+    //   Կ    迭 ü
+    void add(std::shared_ptr<slot_type> new_slot) {
+      std::vector<const slot_array*> garbage;
+      {
+        std::lock_guard<std::mutex> lck(connect_mutex_); // 迭 ü ȣ
+        auto next = copy_alive(1);
+        next->emplace_back(std::move(new_slot));
+        replace(next, &garbage);
       }
+      release(garbage);
+      reclaim();
+    }
 
-      lck.unlock(); // Ʈ ȣ 
-      (**it)(args...); //  
-      lck.lock(); // ٽ ȣ
-      ++it;
+    //    迭 ü
+    void compact() override {
+      std::vector<const slot_array*> garbage;
+      {
+        std::lock_guard<std::mutex> lck(connect_mutex_); // 迭 ü ȣ
+        const auto current = slots_.load();
+        const bool has_expired = std::any_of(current->begin(), current->end(),
+                                             [](const std::shared_ptr<slot_type>& s) { return s->expired(); });
+        if (has_expired)
+          replace(copy_alive(0), &garbage);
+      }
+      release(garbage);
+      reclaim();
     }
-  }
 
- private:
-  mutable std::mutex connect_mutex_; //  Ʈ ȣ  mutex
-  slot_list slot_list_; //   Ʈ
+    //  迭  ȣ ( )
+    template<typename ...Args2>
+    void emit(Args2&... args) {
+      emitter_guard guard(*this);
+      const auto slots = slots_.load();
+      for (const auto& s : *slots)
+        s->call(args...); //   (  ǳʶ)
+    }
+
+    std::size_t slot_count() {
+      emitter_guard guard(*this);
+      return slots_.load()->size();
+    }
+
+    // ȣ  ٲ      ȣ     (trackable )
+    // - ȣ   phase_ īͿ Ƿ, phase_ ٲٸ  ȣ ٸ īͿ 
+    //    īʹ ٸ    ( Ǿ )
+    // - phase_   ʰ  ȣ   Ƿ  ī͸ ʷ ٸ
+    // -  尡  ñ׳ ȣ ̸( ȿ )  ȣ ٸ 
+    void synchronize() override {
+      for (int i = 0; i < 2; ++i) {
+        const unsigned phase = phase_.fetch_add(1) & 1u;
+        const auto own = detail::own_calls(this, phase);
+        while (emitters_[phase].load() > own)
+          std::this_thread::yield();
+      }
+    }
+
+   private:
+    //   ȣ   RAII ü ( ܸ  )
+    // -  ȣ    ٸ 迭  
+    struct emitter_guard {
+      explicit emitter_guard(state& owner) : owner_(owner) {
+        record_.owner = &owner;
+        record_.phase = owner.phase_.load() & 1u;
+        owner_.emitters_[record_.phase].fetch_add(1);
+        record_.next = detail::call_stack();
+        detail::call_stack() = &record_;
+      }
+      ~emitter_guard() {
+        detail::call_stack() = record_.next;
+        if (owner_.emitters_[record_.phase].fetch_sub(1) == 1 && owner_.has_retired_.load())
+          owner_.reclaim();
+      }
+      state& owner_;
+      detail::call_record record_;
+    };
+
+    //   ȣ  ( ī )
+    // - 迭 ü ڿ   迭  ȣ  īͿ ̹  
+    std::size_t emitters() const {
+      return emitters_[0].load() + emitters_[1].load();
+    }
+
+    //  迭   Ը  (connect_mutex_  ¿ ȣ)
+    slot_array* copy_alive(std::size_t extra) const {
+      const auto current = slots_.load();
+      auto next = new slot_array();
+      next->reserve(current->size() + extra);
+      for (const auto& s : *current) {
+        if (!s->expired())
+          next->push_back(s);
+      }
+      return next;
+    }
+
+    // 迭 ü (connect_mutex_  ¿ ȣ)
+    // -  迭 ߴٰ   ȣ   garbage ѱ
+    // - ü  ȣ  0̸  ȣ   迭 Ƿ  迭 ص 
+    // - ȣ  ̸ has_retired_  ΰ,  ȣ   reclaim() 
+    void replace(const slot_array* next, std::vector<const slot_array*>* garbage) {
+      retired_.push_back(slots_.exchange(next));
+      if (emitters() == 0) {
+        garbage->swap(retired_);
+        has_retired_.store(false);
+      } else {
+        has_retired_.store(true);
+      }
+    }
+
+    //  迭  (ü  Ǵ  ȣ ģ )
+    // -  尡 ٸ ʵ try_lock õϸ,   ϸ    
+    //   (connect/disconnect  Ǭ  ٽ reclaim() ȣ)
+    // - has_retired_ emitters_  ϰ ϹǷ, ü  ȣ ᰡ ĵ
+    //   밳   ϳ ϸ,   ģ 迭  ȣ   
+    void reclaim() {
+      std::vector<const slot_array*> garbage;
+      {
+        std::unique_lock<std::mutex> lck(connect_mutex_, std::try_to_lock);
+        if (!lck.owns_lock() || retired_.empty() || emitters() != 0)
+          return;
+        garbage.swap(retired_);
+        has_retired_.store(false);
+      }
+      release(garbage);
+    }
+
+    // 迭  ( Ҹڰ ٽ disconnect  Ƿ  ۿ ȣ)
+    static void release(std::vector<const slot_array*>& garbage) {
+      for (auto slots : garbage)
+        delete slots;
+    }
+
+    std::mutex connect_mutex_;                           // 迭 ü ȣ  mutex
+    std::atomic<const slot_array*> slots_{new slot_array()}; //   迭
+    std::atomic_size_t emitters_[2] = {{0}, {0}};        //   ȣ  (phase_)
+    std::atomic<unsigned> phase_{0};                     //  ȣ  ī (synchronize() ٲ)
+    std::atomic_bool has_retired_{false};                // retired_  ٸ 迭 
+    std::vector<const slot_array*> retired_;             // üǾ    迭
+  };
+
+  std::shared_ptr<state> state_ = std::make_shared<state>(); //  
 };
 
+template<typename R, typename ...Args>
+constexpr std::size_t signal<R(Args...)>::kDefaultQueueCapacity;
+
 } // namespace sample
 
 #endif // EYEDID_CPP_SAMPLE_SIMPLE_SIGNAL_H_
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "telemetry.h"
+
+namespace sample {
+
+constexpr std::size_t TelemetryPipeline::kDefaultCapacity;
+constexpr std::chrono::milliseconds TelemetryPipeline::kDefaultFlushInterval;
+
+// **BinaryFileTelemetrySink 클래스**
+BinaryFileTelemetrySink::BinaryFileTelemetrySink(const std::string& path)
+: file_(path, std::ios::binary | std::ios::trunc) {
+  if (!file_.is_open())
+    return;
+
+  const char magic[4] = {'E', 'Y', 'T', 'L'};
+  const std::uint32_t version = kTelemetryVersion;
+  const std::uint32_t record_size = sizeof(TelemetryRecord);
+  file_.write(magic, sizeof(magic));
+  file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  file_.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+}
+
+void BinaryFileTelemetrySink::write(const TelemetryRecord* records, std::size_t count) {
+  if (file_.is_open())
+    file_.write(reinterpret_cast<const char*>(records), static_cast<std::streamsize>(count * sizeof(TelemetryRecord)));
+}
+
+void BinaryFileTelemetrySink::flush() {
+  file_.flush();
+}
+
+// **TextTelemetrySink 클래스**
+void TextTelemetrySink::write(const TelemetryRecord* records, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& r = records[i];
+    stream_ << "Face Score: " << r.timestamp << ", " << r.face_score << '\n'
+            << "Blink: " << r.left_openness << ", " << r.right_openness << ", "
+            << static_cast<int>(r.blink_left) << ", " << static_cast<int>(r.blink_right) << '\n'
+            << "Attention: " << r.attention << '\n'
+            << "Drowsiness: " << static_cast<int>(r.drowsy) << '\n';
+  }
+}
+
+void TextTelemetrySink::flush() {
+  stream_.flush();
+}
+
+// **TelemetryPipeline 클래스**
+TelemetryPipeline::TelemetryPipeline(std::size_t capacity)
+: queue_(capacity) {
+  batch_.reserve(queue_.capacity());
+}
+
+TelemetryPipeline::~TelemetryPipeline() {
+  stop();
+}
+
+void TelemetryPipeline::start(std::unique_ptr<TelemetrySink> sink, std::chrono::milliseconds flush_interval) {
+  stop();
+  if (!sink)
+    return;
+
+  sink_ = std::move(sink);
+  stop_ = false;
+  running_.store(true);
+  thread_ = std::thread([this, flush_interval]() {
+    run_impl(flush_interval);
+  });
+}
+
+void TelemetryPipeline::stop() {
+  running_.store(false);
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+
+  if (thread_.joinable())
+    thread_.join();
+  sink_.reset();
+}
+
+void TelemetryPipeline::push(const TelemetryRecord& record) {
+  if (!running_.load(std::memory_order_relaxed))
+    return;
+
+  TelemetryRecord copy = record;
+  if (queue_.try_push(std::move(copy)))
+    recorded_.fetch_add(1, std::memory_order_relaxed);
+  else
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+TelemetryPipeline::Stats TelemetryPipeline::stats() const {
+  Stats stats;
+  stats.recorded = recorded_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.written = written_.load(std::memory_order_relaxed);
+  stats.batches = batches_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 기록 스레드
+// - 생산자는 알림을 보내지 않으므로(시스템 호출 없음) 주기적으로 깨어나 큐를 비움
+// - 종료 요청 시 남은 레코드를 모두 기록
+void TelemetryPipeline::run_impl(std::chrono::milliseconds flush_interval) {
+  std::unique_lock<std::mutex> lck(mutex_);
+  while (!stop_) {
+    cv_.wait_for(lck, flush_interval, [this]() { return stop_; });
+    lck.unlock();
+    drain();
+    lck.lock();
+  }
+  lck.unlock();
+  drain();
+}
+
+void TelemetryPipeline::drain() {
+  TelemetryRecord record;
+  batch_.clear();
+  while (queue_.try_pop(&record))
+    batch_.push_back(record);
+
+  if (batch_.empty())
+    return;
+
+  sink_->write(batch_.data(), batch_.size());
+  sink_->flush();
+  written_.fetch_add(batch_.size(), std::memory_order_relaxed);
+  batches_.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace sample
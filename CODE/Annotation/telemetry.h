@@ -0,0 +1,170 @@
+#ifndef EYEDID_CPP_SAMPLE_TELEMETRY_H_
+#define EYEDID_CPP_SAMPLE_TELEMETRY_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "mpsc_queue.h"
+
+namespace sample {
+
+/**
+ * TelemetryRecord 구조체:
+ * - SDK 추적 콜백(OnMetrics) 한 번에 해당하는 고정 크기 레코드
+ * - 파일에는 이 구조체를 그대로 기록하므로 필드를 추가할 때는 kTelemetryVersion을 올려야 함
+ */
+struct TelemetryRecord {
+  std::uint64_t timestamp = 0;     // SDK 타임스탬프 (ms)
+
+  float face_score = 0;            // 얼굴 탐지 점수
+  float face_left = 0;             // 얼굴 영역 (카메라 이미지 기준 비율)
+  float face_top = 0;
+  float face_right = 0;
+  float face_bottom = 0;
+  float pitch = 0;                 // 얼굴 회전 (도)
+  float yaw = 0;
+  float roll = 0;
+  float center_x = 0;              // 카메라 기준 얼굴 중심 위치 (mm)
+  float center_y = 0;
+  float center_z = 0;
+
+  float left_openness = 0;         // 눈 열림 정도 (0.0 ~ 1.0)
+  float right_openness = 0;
+  float attention = 0;             // 주의 점수 (0.0 ~ 1.0)
+  float drowsiness_intensity = 0;  // 졸음 강도 (0.0 ~ 1.0)
+
+  std::uint8_t blink_left = 0;     // 왼쪽 눈 깜박임 여부
+  std::uint8_t blink_right = 0;    // 오른쪽 눈 깜박임 여부
+  std::uint8_t blink = 0;          // 양쪽 눈 깜박임 여부
+  std::uint8_t drowsy = 0;         // 졸음 여부
+  std::uint8_t reserved[8] = {};   // 레코드 크기를 8바이트 배수로 맞춤 (패딩 없이 기록)
+};
+
+static_assert(std::is_trivially_copyable<TelemetryRecord>::value, "TelemetryRecord must be a POD record");
+static_assert(sizeof(TelemetryRecord) == 80, "TelemetryRecord layout changed: bump kTelemetryVersion");
+
+constexpr std::uint32_t kTelemetryVersion = 1;
+
+/**
+ * TelemetrySink 클래스:
+ * - TelemetryPipeline의 기록 스레드가 모은 레코드를 한 번에 전달받는 인터페이스
+ * - write()/flush()는 기록 스레드에서만 호출됨
+ */
+class TelemetrySink {
+ public:
+  virtual ~TelemetrySink() = default;
+
+  virtual void write(const TelemetryRecord* records, std::size_t count) = 0;
+  virtual void flush() {}
+};
+
+/**
+ * BinaryFileTelemetrySink 클래스:
+ * - 파일 헤더 뒤에 TelemetryRecord를 그대로 이어서 기록
+ * - 헤더: "EYTL" + 버전(uint32) + 레코드 크기(uint32)
+ */
+class BinaryFileTelemetrySink : public TelemetrySink {
+ public:
+  explicit BinaryFileTelemetrySink(const std::string& path);
+
+  bool is_open() const { return file_.is_open(); }
+
+  void write(const TelemetryRecord* records, std::size_t count) override;
+  void flush() override;
+
+ private:
+  std::ofstream file_;
+};
+
+/**
+ * TextTelemetrySink 클래스:
+ * - 레코드를 사람이 읽을 수 있는 텍스트로 출력 (기존 콘솔 출력과 같은 형식)
+ */
+class TextTelemetrySink : public TelemetrySink {
+ public:
+  explicit TextTelemetrySink(std::ostream& stream) : stream_(stream) {}
+
+  void write(const TelemetryRecord* records, std::size_t count) override;
+  void flush() override;
+
+ private:
+  std::ostream& stream_;
+};
+
+/**
+ * TelemetryPipeline 클래스:
+ * - SDK 콜백 스레드에서 push()로 레코드를 잠금 없는 큐에 넣고 바로 반환
+ * - 기록 스레드가 주기적으로 큐를 비워 한 번에 싱크로 전달
+ * - 큐가 가득 차면 새 레코드를 버림 (추적 스레드를 막지 않음)
+ * - start()/stop()은 한 스레드에서 호출해야 함
+ */
+class TelemetryPipeline {
+ public:
+  // 기록 통계
+  struct Stats {
+    std::uint64_t recorded = 0; // 큐에 넣은 레코드 수
+    std::uint64_t dropped = 0;  // 큐가 가득 차서 버린 레코드 수
+    std::uint64_t written = 0;  // 싱크에 전달한 레코드 수
+    std::uint64_t batches = 0;  // 싱크 write() 호출 수
+  };
+
+  static constexpr std::size_t kDefaultCapacity = 1024;
+  static constexpr std::chrono::milliseconds kDefaultFlushInterval{100};
+
+  explicit TelemetryPipeline(std::size_t capacity = kDefaultCapacity);
+  ~TelemetryPipeline();
+
+  TelemetryPipeline(const TelemetryPipeline&) = delete;
+  TelemetryPipeline& operator=(const TelemetryPipeline&) = delete;
+
+  /**
+   * 기록 시작 (이미 기록 중이면 이전 싱크를 정리한 뒤 교체)
+   * @param sink           레코드를 전달받을 싱크
+   * @param flush_interval 기록 스레드가 큐를 비우는 주기
+   */
+  void start(std::unique_ptr<TelemetrySink> sink,
+             std::chrono::milliseconds flush_interval = kDefaultFlushInterval);
+
+  void stop(); // 남은 레코드를 기록한 뒤 기록 스레드 종료
+
+  bool running() const { return running_.load(std::memory_order_relaxed); }
+
+  // 레코드 추가 (SDK 콜백 스레드, 잠금 없음). 기록 중이 아니면 무시
+  void push(const TelemetryRecord& record);
+
+  Stats stats() const;
+
+ private:
+  void run_impl(std::chrono::milliseconds flush_interval); // 기록 스레드 실행 로직
+  void drain(); // 큐의 레코드를 싱크로 전달 (기록 스레드)
+
+  MpscQueue<TelemetryRecord> queue_;
+  std::unique_ptr<TelemetrySink> sink_;  // 기록 스레드 전용
+  std::vector<TelemetryRecord> batch_;   // 기록 스레드 전용
+
+  std::mutex mutex_;                     // 종료 대기용
+  std::condition_variable cv_;
+  bool stop_ = false;
+  std::atomic_bool running_{false};
+  std::thread thread_;
+
+  std::atomic<std::uint64_t> recorded_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> written_{0};
+  std::atomic<std::uint64_t> batches_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_TELEMETRY_H_
@@ -0,0 +1,81 @@
+/**
+ * CameraThread 시험: 프레임 소스를 돌려받은 뒤의 재개 (release_source() → resume())
+ * - 소스가 없으면 resume()은 false를 반환하고 캡처 루프는 소스 없이 실행되지 않아야 함
+ * - 돌려받은 소스로 run()을 다시 호출하면 캡처가 이어져야 함
+ *
+ * 빌드: camera_thread.cc frame_source.cc frame_pool.cc frame_ring.cc thread_affinity.cc latency_trace.cc
+ * 실행: 실패하면 assert로 중단, 성공하면 "ok" 출력
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "camera_thread.h"
+#include "frame_source.h"
+
+using namespace sample;
+
+namespace {
+
+// 1ms마다 작은 프레임을 만드는 소스 (읽은 횟수를 셈)
+class CountingSource : public FrameSource {
+ public:
+  explicit CountingSource(std::atomic<int>* reads) : reads_(reads) {}
+
+  bool open() override { return true; }
+  void close() override {}
+  bool read(cv::Mat& frame) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    frame.create(4, 4, CV_8UC3);
+    ++*reads_;
+    return true;
+  }
+  std::string name() const override { return "counting"; }
+
+ private:
+  std::atomic<int>* reads_;
+};
+
+void wait_ms(int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+} // namespace
+
+int main() {
+  std::atomic<int> reads{0};
+  CameraThread camera;
+  assert(camera.run(std::unique_ptr<FrameSource>(new CountingSource(&reads))));
+  wait_ms(20);
+  assert(reads.load() > 0);
+
+  // 소스를 돌려받으면 재개할 수 없고 읽기도 멈춤
+  auto source = camera.release_source();
+  assert(source != nullptr);
+  assert(!camera.resume());
+  const int reads_after_release = reads.load();
+  wait_ms(20);
+  assert(reads.load() == reads_after_release);
+
+  // 소스 없이 run()도 실패
+  assert(!camera.run(nullptr));
+  assert(!camera.resume());
+
+  // 돌려받은 소스로 다시 실행
+  assert(camera.run(std::move(source)));
+  wait_ms(20);
+  assert(reads.load() > reads_after_release);
+
+  // 일시정지 후 재개
+  camera.pause();
+  assert(camera.resume());
+
+  camera.join();
+  std::puts("ok");
+  return 0;
+}
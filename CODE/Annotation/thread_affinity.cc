@@ -0,0 +1,74 @@
+#include "thread_affinity.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+namespace sample {
+
+std::vector<int> allowed_cores() {
+  std::vector<int> cores;
+
+#if defined(_WIN32)
+  DWORD_PTR process_mask = 0;
+  DWORD_PTR system_mask = 0;
+  if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+    for (int core = 0; core < static_cast<int>(sizeof(DWORD_PTR) * 8); ++core) {
+      if (process_mask & (DWORD_PTR{1} << core))
+        cores.push_back(core);
+    }
+  }
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int core = 0; core < CPU_SETSIZE; ++core) {
+      if (CPU_ISSET(core, &set))
+        cores.push_back(core);
+    }
+  }
+#endif
+
+  if (cores.empty()) {
+    const auto count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int core = 0; core < count; ++core)
+      cores.push_back(core);
+  }
+  return cores;
+}
+
+int hardware_cores() {
+  return static_cast<int>(allowed_cores().size());
+}
+
+bool pin_thread(std::thread& thread, int core) {
+  if (!thread.joinable() || core < 0)
+    return false;
+
+  // 허용되지 않은 코어는 돌려 쓰지 않고 실패로 처리 (나머지 연산으로 감싸면 다른 스레드와 겹침)
+  const auto cores = allowed_cores();
+  if (!std::binary_search(cores.begin(), cores.end(), core))
+    return false;
+
+#if defined(_WIN32)
+  const DWORD_PTR mask = DWORD_PTR{1} << core;
+  return SetThreadAffinityMask(static_cast<HANDLE>(thread.native_handle()), mask) != 0;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+} // namespace sample
@@ -0,0 +1,32 @@
+#ifndef EYEDID_CPP_SAMPLE_THREAD_AFFINITY_H_
+#define EYEDID_CPP_SAMPLE_THREAD_AFFINITY_H_
+
+#include <thread>
+#include <vector>
+
+namespace sample {
+
+/**
+ * 스레드를 CPU 코어 하나에 고정
+ * - 카메라마다 캡처/SDK 전달 스레드를 다른 코어에 두어 서로의 캐시와 실행 시간을 빼앗지 않게 함
+ * - Linux(pthread_setaffinity_np)와 Windows(SetThreadAffinityMask)만 지원
+ * @param thread 실행 중인 스레드
+ * @param core   코어 번호 (allowed_cores()에 있는 번호, 없으면 고정하지 않음)
+ * @return 고정했으면 true, 지원하지 않거나 실패하면 false (스레드는 그대로 실행됨)
+ */
+bool pin_thread(std::thread& thread, int core);
+
+/**
+ * 이 프로세스가 사용할 수 있는 코어 번호 목록 (오름차순)
+ * - Linux는 sched_getaffinity, Windows는 GetProcessAffinityMask 결과
+ *   (taskset이나 cgroup cpuset으로 제한되면 번호가 0부터 연속하지 않을 수 있음)
+ * - 알 수 없으면 0부터 hardware_concurrency - 1까지
+ */
+std::vector<int> allowed_cores();
+
+// 사용할 수 있는 코어 수 (allowed_cores()의 크기, 알 수 없으면 1)
+int hardware_cores();
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_THREAD_AFFINITY_H_
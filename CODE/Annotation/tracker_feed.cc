@@ -0,0 +1,122 @@
+#include "tracker_feed.h"
+
+#include <chrono>
+
+#include "thread_affinity.h"
+
+namespace sample {
+
+LatestFrameFeed::LatestFrameFeed(TrackerManager& tracker_manager, cv::Size target_size)
+: tracker_manager_(tracker_manager),
+  converter_(target_size) {
+  thread_ = std::thread([this]() {
+    run_impl();
+  });
+}
+
+LatestFrameFeed::~LatestFrameFeed() {
+  join();
+}
+
+// 새 프레임 전달
+// - 생산자 슬롯에 프레임을 채운 뒤 공개
+// - 소비자가 가져가기 전의 프레임을 덮어썼다면 드롭으로 기록
+// - 같은 소스에서 프레임 번호가 건너뛰었으면 그 전에 빠진 프레임으로 기록
+void LatestFrameFeed::push(const FrameEnvelope& envelope) {
+  if (envelope.source_id == last_source_ && last_sequence_ != 0 && envelope.sequence > last_sequence_ + 1)
+    missed_.fetch_add(envelope.sequence - last_sequence_ - 1, std::memory_order_relaxed);
+  last_sequence_ = envelope.sequence;
+  last_source_ = envelope.source_id;
+
+  auto& slot = slots_.back();
+  slot = envelope;
+
+  const bool dropped = slots_.publish();
+  slots_.back().frame.release(); // 드롭되었거나 처리가 끝난 프레임의 참조를 바로 놓음
+
+  pushed_.fetch_add(1, std::memory_order_relaxed);
+  if (dropped)
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+
+  if (waiting_.load()) {
+    { std::lock_guard<std::mutex> lck(mutex_); } // 대기 직전의 소비자가 알림을 놓치지 않도록 함
+    cv_.notify_one();
+  }
+}
+
+void LatestFrameFeed::join() {
+  stop_.store(true);
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+  }
+  cv_.notify_one();
+
+  if (thread_.joinable())
+    thread_.join();
+}
+
+bool LatestFrameFeed::set_affinity(int core) {
+  return pin_thread(thread_, core);
+}
+
+LatestFrameFeed::Stats LatestFrameFeed::stats() const {
+  Stats stats;
+  stats.pushed = pushed_.load(std::memory_order_relaxed);
+  stats.submitted = submitted_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.rejected = rejected_.load(std::memory_order_relaxed);
+  stats.missed = missed_.load(std::memory_order_relaxed);
+  stats.last_latency_us = last_latency_us_.load(std::memory_order_relaxed);
+  stats.max_latency_us = max_latency_us_.load(std::memory_order_relaxed);
+  const auto count = stats.submitted + stats.rejected;
+  if (count != 0)
+    stats.mean_latency_us = total_latency_us_.load(std::memory_order_relaxed) / static_cast<std::int64_t>(count);
+  return stats;
+}
+
+// 소비자 스레드
+// - 새 프레임이 공개되면 가져와서 처리
+void LatestFrameFeed::run_impl() {
+  LatencyTracer::set_thread_name("tracker_feed");
+  while (!stop_.load()) {
+    if (!slots_.acquire()) {
+      std::unique_lock<std::mutex> lck(mutex_);
+      waiting_.store(true);
+      cv_.wait_for(lck, std::chrono::milliseconds(100), [this]() -> bool {
+        return stop_.load() || slots_.fresh();
+      });
+      waiting_.store(false);
+      continue;
+    }
+
+    submit(slots_.front());
+    slots_.front().frame.release();
+  }
+}
+
+// RGB 변환(+크기 조정)을 한 번에 수행한 뒤 SDK에 전달하고 캡처 → 전달 지연을 기록
+void LatestFrameFeed::submit(const FrameEnvelope& envelope) {
+  if (envelope.frame.empty())
+    return;
+
+  TraceSpan span(TraceStage::kSubmit, envelope.trace_id());
+  converter_.convert(envelope.frame, &converted_);
+
+  const auto latency_us = (LatencyTracer::now_ns() - envelope.capture_ns) / 1000;
+  rgb_envelope_ = envelope;
+  rgb_envelope_.frame = converted_; // 캡처 정보는 그대로 두고 변환된 프레임으로 교체
+  const bool added = tracker_manager_.addFrame(rgb_envelope_);
+  rgb_envelope_.frame.release();
+  if (added)
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+  else
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+
+  last_latency_us_.store(latency_us, std::memory_order_relaxed);
+  total_latency_us_.fetch_add(latency_us, std::memory_order_relaxed);
+  auto max_latency = max_latency_us_.load(std::memory_order_relaxed);
+  while (max_latency < latency_us &&
+         !max_latency_us_.compare_exchange_weak(max_latency, latency_us, std::memory_order_relaxed)) {}
+}
+
+} // namespace sample
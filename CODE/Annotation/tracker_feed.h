@@ -0,0 +1,98 @@
+#ifndef EYEDID_CPP_SAMPLE_TRACKER_FEED_H_
+#define EYEDID_CPP_SAMPLE_TRACKER_FEED_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "color_resize.h"
+#include "frame_envelope.h"
+#include "latency_trace.h"
+#include "opencv2/opencv.hpp"
+#include "tracker_manager.h"
+#include "triple_buffer.h"
+
+namespace sample {
+
+/**
+ * LatestFrameFeed 클래스:
+ * - TrackerManager::addFrame 앞에 두는 "가장 최신 프레임만" 전달 단계
+ * - 항상 마지막으로 들어온 프레임 하나만 보관하고, 처리되기 전에 새 프레임이 오면
+ *   이전 프레임을 원자적으로 교체(드롭)함
+ * - 별도의 스레드에서 RGB 변환(+크기 조정)과 addFrame을 수행하므로 SDK가 느려도 지연이 쌓이지 않음
+ * - push()는 한 스레드(보통 카메라 스레드)에서만 호출해야 함
+ */
+class LatestFrameFeed {
+ public:
+  // 전달 통계
+  struct Stats {
+    std::uint64_t pushed = 0;         // push()로 들어온 프레임 수
+    std::uint64_t submitted = 0;      // addFrame으로 전달한 프레임 수
+    std::uint64_t dropped = 0;        // 처리되기 전에 새 프레임으로 교체된 프레임 수
+    std::uint64_t rejected = 0;       // addFrame이 실패한 프레임 수
+    std::uint64_t missed = 0;         // push() 전에 빠진 프레임 수 (프레임 번호의 빈 번호, 카메라 스레드에서 버린 프레임)
+    std::int64_t last_latency_us = 0; // 마지막 프레임의 캡처 → 전달 지연 (us)
+    std::int64_t max_latency_us = 0;  // 최대 캡처 → 전달 지연 (us)
+    std::int64_t mean_latency_us = 0; // 평균 캡처 → 전달 지연 (us)
+  };
+
+  /**
+   * @param tracker_manager 프레임을 전달할 TrackerManager
+   * @param target_size     SDK에 전달할 프레임 크기 (비어 있으면 카메라 해상도 유지)
+   */
+  explicit LatestFrameFeed(TrackerManager& tracker_manager, cv::Size target_size = cv::Size());
+  ~LatestFrameFeed();
+
+  LatestFrameFeed(const LatestFrameFeed&) = delete;
+  LatestFrameFeed& operator=(const LatestFrameFeed&) = delete;
+
+  /**
+   * 새 프레임 전달 (BGR)
+   * - 픽셀 데이터는 복사하지 않고 참조만 보관
+   * - 아직 처리되지 않은 이전 프레임은 드롭됨
+   * - 캡처 시각을 SDK 타임스탬프로 사용하고, 캡처 정보는 addFrame까지 그대로 전달
+   * @param envelope 카메라 프레임과 캡처 정보
+   */
+  void push(const FrameEnvelope& envelope);
+
+  void join(); // 스레드 종료 대기
+
+  // 변환/전달 스레드를 CPU 코어 하나에 고정 (지원하지 않으면 false)
+  bool set_affinity(int core);
+
+  Stats stats() const;
+
+ private:
+  void run_impl(); // 내부 스레드 실행 로직
+  void submit(const FrameEnvelope& envelope); // 변환 후 SDK에 전달
+
+  TrackerManager& tracker_manager_;
+
+  TripleBuffer<FrameEnvelope> slots_; // 생산자(push) → 소비자 스레드 최신 프레임 전달
+  BgrToRgbResizer converter_;     // RGB 변환 + 크기 조정 (소비자 스레드 전용)
+  cv::Mat converted_;             // 변환 결과 버퍼 (소비자 스레드 전용)
+  FrameEnvelope rgb_envelope_;    // addFrame에 넘길 프레임 정보 (frame은 converted_, 소비자 스레드 전용)
+  std::uint64_t last_sequence_ = 0; // 마지막으로 push()된 프레임 번호 (생산자 전용)
+  std::uint32_t last_source_ = 0;
+
+  std::mutex mutex_;              // 조건 변수 대기용
+  std::condition_variable cv_;    // 새 프레임 알림
+  std::atomic_bool waiting_{false};
+  std::atomic_bool stop_{false};
+  std::thread thread_;
+
+  std::atomic<std::uint64_t> pushed_{0};
+  std::atomic<std::uint64_t> submitted_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> rejected_{0};
+  std::atomic<std::uint64_t> missed_{0};
+  std::atomic<std::int64_t> last_latency_us_{0};
+  std::atomic<std::int64_t> max_latency_us_{0};
+  std::atomic<std::int64_t> total_latency_us_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_TRACKER_FEED_H_
@@ -1,6 +1,5 @@
 #include "tracker_manager.h"
 
-#include <iostream> // 디버깅 출력을 위한 I/O 라이브러리
 #include <utility>  // std::move 등 유틸리티 함수 포함
 #include <vector>   // 벡터 자료구조 사용
 
@@ -10,12 +9,11 @@ namespace sample {
 
 /**
  * 창의 크기와 패딩을 기반으로 영역(Rect)을 반환
- * @param window_name 창 이름
+ * @param window_rect 창의 위치와 크기 (창 위치 캐시의 값)
  * @param padding 패딩 값 (기본값: 30)
  * @return 패딩이 적용된 창의 영역 좌표 (벡터 형태로 반환: {x1, y1, x2, y2})
  */
-static std::vector<float> getWindowRectWithPadding(const char* window_name, int padding = 30) {
-  const auto window_rect = eyedid::getWindowRect(window_name); // 창의 현재 위치와 크기 가져오기
+static std::vector<float> getWindowRectWithPadding(const WindowGeometry& window_rect, int padding = 30) {
   return {
     static_cast<float>(window_rect.x + padding), // 좌측 상단 x 좌표 + 패딩
     static_cast<float>(window_rect.y + padding), // 좌측 상단 y 좌표 + 패딩
@@ -33,6 +31,15 @@ void TrackerManager::OnMetrics(uint64_t timestamp,
                               const EyedidFaceData &face_data,
                               const EyedidBlinkData &blink_data,
                               const EyedidUserStatusData &user_status_data) {
+  LatencyTracer::set_thread_name("sdk_callback");
+  if (!findFrame(timestamp, &frame_info_))
+    frame_info_ = FrameInfo();
+  TraceSpan span(TraceStage::kMetrics, FrameEnvelope::make_trace_id(frame_info_.source_id, frame_info_.sequence));
+  on_metrics_(timestamp, gaze_data, face_data, blink_data, user_status_data); // 원본 데이터 전달
+
+  record_ = TelemetryRecord();
+  record_.timestamp = timestamp;
+
   // 각 데이터를 해당 처리 메서드로 전달
   this->OnGaze(timestamp, gaze_data.x, gaze_data.y, gaze_data.fixation_x, gaze_data.fixation_y,
                gaze_data.tracking_state, gaze_data.movement_state);
@@ -43,6 +50,8 @@ void TrackerManager::OnMetrics(uint64_t timestamp,
                 blink_data.left_openness, blink_data.right_openness);
   this->OnAttention(user_status_data.attention_score);
   this->OnDrowsiness(timestamp, user_status_data.is_drowsy, user_status_data.drowsiness_intensity);
+
+  telemetry_.push(record_); // 기록 스레드로 전달 (대기 없음)
 }
 
 /**
@@ -60,21 +69,71 @@ void TrackerManager::OnGaze(uint64_t timestamp,
                             float fixation_x, float fixation_y,
                             EyedidTrackingState tracking_state,
                             EyedidEyeMovementState eye_movement_state) {
+  GazeSample sample;
+  sample.timestamp = timestamp;
+  sample.movement_state = eye_movement_state;
+  sample.frame_sequence = frame_info_.sequence;
+  sample.source_id = frame_info_.source_id;
+  sample.capture_ns = frame_info_.capture_ns;
+
   if (tracking_state != kEyedidTrackingSuccess) {
     // 추적 실패 시 초기화된 값으로 콜백 호출
+    aoi_.process(sample); // 모든 관심 영역에서 나감
+    on_gaze_sample_(sample);
     on_gaze_(0, 0, false);
     return;
   }
 
-  // 창의 시작 좌표를 가져와서 시선 좌표를 보정
-  auto winPos = eyedid::getWindowPosition(window_name_);
+  // 캐시된 창의 시작 좌표로 시선 좌표를 보정 (창 시스템 호출 없음)
+  const auto winPos = window_geometry_.load();
   x -= static_cast<float>(winPos.x);
   y -= static_cast<float>(winPos.y);
 
+  sample.x = x;
+  sample.y = y;
+  sample.fixation_x = fixation_x - static_cast<float>(winPos.x);
+  sample.fixation_y = fixation_y - static_cast<float>(winPos.y);
+  sample.valid = true;
+  aoi_.process(sample);
+  on_gaze_sample_(sample);
+
+  // 화면에 그릴 좌표는 시선 필터를 거침 (평활화/지연 보상)
+  if (gaze_filter_pending_.load(std::memory_order_acquire))
+    swapGazeFilter();
+  if (gaze_filter_ != nullptr) {
+    const auto filtered = gaze_filter_->apply(timestamp, cv::Point2f(x, y));
+    x = filtered.x;
+    y = filtered.y;
+  }
+
   // 보정된 좌표를 정수로 변환하여 콜백 호출
   on_gaze_(static_cast<int>(x), static_cast<int>(y), true);
 }
 
+/**
+ * 시선 필터 설정
+ * - 대기 자리에 넣고 표시만 하며, SDK 콜백 스레드가 다음 시선에서 교체 (swapGazeFilter)
+ * - 아직 교체되지 않은 이전 대기 필터는 잠금을 푼 뒤에 소멸
+ * @param filter 시선 필터 (nullptr이면 필터 없음)
+ */
+void TrackerManager::setGazeFilter(std::unique_ptr<GazeFilter> filter) {
+  std::lock_guard<std::mutex> lck(gaze_filter_mutex_);
+  pending_gaze_filter_.swap(filter);
+  gaze_filter_pending_.store(true, std::memory_order_release);
+}
+
+/**
+ * 대기 중인 시선 필터로 교체 (SDK 콜백 스레드, setGazeFilter() 뒤 첫 시선에서 한 번)
+ * - 이전 필터는 잠금을 푼 뒤에 소멸
+ */
+void TrackerManager::swapGazeFilter() {
+  std::unique_ptr<GazeFilter> previous;
+  std::lock_guard<std::mutex> lck(gaze_filter_mutex_);
+  previous = std::move(gaze_filter_);
+  gaze_filter_ = std::move(pending_gaze_filter_);
+  gaze_filter_pending_.store(false, std::memory_order_relaxed);
+}
+
 /**
  * 얼굴 데이터를 처리하는 메서드
  * @param timestamp 타임스탬프
@@ -102,7 +161,17 @@ void TrackerManager::OnFace(uint64_t timestamp,
                             float center_x,
                             float center_y,
                             float center_z) {
-  std::cout << "Face Score: " << timestamp << ", " << score << '\n'; // 얼굴 점수 출력
+  record_.face_score = score;
+  record_.face_left = left;
+  record_.face_top = top;
+  record_.face_right = right;
+  record_.face_bottom = bottom;
+  record_.pitch = pitch;
+  record_.yaw = yaw;
+  record_.roll = roll;
+  record_.center_x = center_x;
+  record_.center_y = center_y;
+  record_.center_z = center_z;
 }
 
 /**
@@ -110,7 +179,7 @@ void TrackerManager::OnFace(uint64_t timestamp,
  * @param score 주의 점수
  */
 void TrackerManager::OnAttention(float score) {
-  std::cout << "Attention: " << score << '\n'; // 주의 점수 출력
+  record_.attention = score;
 }
 
 /**
@@ -124,8 +193,11 @@ void TrackerManager::OnAttention(float score) {
  */
 void TrackerManager::OnBlink(uint64_t timestamp, bool isBlinkLeft, bool isBlinkRight, bool isBlink,
                              float leftOpenness, float rightOpenness) {
-  std::cout << "Blink: " << leftOpenness << ", " << rightOpenness << ", " 
-            << isBlinkLeft <<  ", " << isBlinkRight  << '\n'; // 눈 깜박임 데이터 출력
+  record_.blink_left = isBlinkLeft;
+  record_.blink_right = isBlinkRight;
+  record_.blink = isBlink;
+  record_.left_openness = leftOpenness;
+  record_.right_openness = rightOpenness;
 }
 
 /**
@@ -135,7 +207,8 @@ void TrackerManager::OnBlink(uint64_t timestamp, bool isBlinkLeft, bool isBlinkR
  * @param intensity 졸음 강도
  */
 void TrackerManager::OnDrowsiness(uint64_t timestamp, bool isDrowsiness, float intensity) {
-  std::cout << "Drowsiness: " << isDrowsiness << '\n'; // 졸음 상태 출력
+  record_.drowsy = isDrowsiness;
+  record_.drowsiness_intensity = intensity;
 }
 
 /**
@@ -152,11 +225,11 @@ void TrackerManager::OnCalibrationProgress(float progress) {
  * @param next_point_y 다음 포인트의 y 좌표
  */
 void TrackerManager::OnCalibrationNextPoint(float next_point_x, float next_point_y) {
-  const auto winPos = eyedid::getWindowPosition(window_name_);
+  const auto winPos = window_geometry_.load();
   const auto x = static_cast<int>(next_point_x - static_cast<float>(winPos.x));
   const auto y = static_cast<int>(next_point_y - static_cast<float>(winPos.y));
   on_calib_next_point_(x, y); // 다음 포인트 콜백 호출
-  gaze_tracker_.startCollectSamples(); // 샘플 수집 시작
+  frame_tracker_->startCollectSamples(); // 샘플 수집 시작
 }
 
 /**
@@ -169,22 +242,73 @@ void TrackerManager::OnCalibrationFinish(const std::vector<float> &calib_data) {
 }
 
 /**
- * Gaze Tracker 초기화
- * @param license_key 인증 키
- * @param options 트래커 옵션
- * @return 초기화 성공 여부
+ * OpenCV 프레임(RGB)을 SDK에 추가
+ * @param timestamp 프레임 타임스탬프 (ms)
+ * @param frame RGB 프레임
+ * @return 프레임 추가 성공 여부
  */
-bool TrackerManager::initialize(const std::string &license_key, const EyedidTrackerOptions& options) {
-  const auto code = gaze_tracker_.initialize(license_key, options); // 트래커 초기화
-  if (code != 0) {
-    std::cerr << "Failed to authenticate (code: " << code << " )\n"; // 오류 출력
-    return false;
+bool TrackerManager::addFrame(std::int64_t timestamp, const cv::Mat& frame) {
+  if (!frame_tracker_)
+    return false; // 초기화 전
+  return frame_tracker_->addFrame(timestamp, frame.data, frame.cols, frame.rows);
+}
+
+/**
+ * 캡처 정보가 붙은 프레임을 SDK에 추가
+ * - SDK 타임스탬프와 캡처 정보를 원형 버퍼에 남겨 SDK 콜백에서 원본 프레임을 찾음
+ * @param envelope RGB 프레임과 캡처 정보
+ * @return 프레임 추가 성공 여부
+ */
+bool TrackerManager::addFrame(const FrameEnvelope& envelope) {
+  auto timestamp = static_cast<std::uint64_t>(envelope.capture_ns / 1000000);
+  if (last_timestamp_ != 0 && timestamp <= last_timestamp_)
+    timestamp = last_timestamp_ + 1; // 같은 ms에 캡처된 프레임도 SDK 콜백에서 구분되도록 함
+  last_timestamp_ = timestamp;
+
+  {
+    std::lock_guard<std::mutex> lck(frames_mutex_);
+    auto& info = frames_[frames_next_];
+    info.timestamp = timestamp;
+    info.sequence = envelope.sequence;
+    info.source_id = envelope.source_id;
+    info.capture_ns = envelope.capture_ns;
+    frames_next_ = (frames_next_ + 1) % kFrameInfoCount;
   }
 
-  gaze_tracker_.setFaceDistance(60); // 얼굴과 카메라 간 거리 설정
-  gaze_tracker_.setTrackingCallback(this); // 추적 콜백 연결
-  gaze_tracker_.setCalibrationCallback(this); // 캘리브레이션 콜백 연결
+  return addFrame(static_cast<std::int64_t>(timestamp), envelope.frame);
+}
+
+/**
+ * SDK 타임스탬프로 addFrame(FrameEnvelope)에 넘긴 프레임의 캡처 정보를 찾음
+ * @param timestamp SDK 타임스탬프 (ms)
+ * @param info 찾은 캡처 정보
+ * @return 찾았는지 여부
+ */
+bool TrackerManager::findFrame(std::uint64_t timestamp, FrameInfo* info) {
+  std::lock_guard<std::mutex> lck(frames_mutex_);
+  for (const auto& frame : frames_) {
+    if (frame.sequence != 0 && frame.timestamp == timestamp) {
+      *info = frame;
+      return true;
+    }
+  }
+  return false;
+}
+
+// initialize(license_key, options)는 eyedid_frame_tracker.cc에 정의 (SDK를 쓰는 코드를 한 파일에 모음)
+
+/**
+ * 지정한 추적기로 초기화
+ * @param tracker 프레임 추적기
+ * @return 초기화 성공 여부
+ */
+bool TrackerManager::initialize(std::unique_ptr<FrameTracker> tracker) {
+  if (!tracker)
+    return false;
 
+  frame_tracker_ = std::move(tracker);
+  frame_tracker_->setTrackingCallback(this); // 추적 콜백 연결
+  frame_tracker_->setCalibrationCallback(this); // 캘리브레이션 콜백 연결
   return true;
 }
 
@@ -2,15 +2,25 @@
 #define EYEDID_CPP_SAMPLE_TRACKER_MANAGER_H_
 
 #include <atomic>    // 캘리브레이션 상태 관리에 사용
+#include <cstdint>   // 고정 크기 정수 타입
 #include <future>    // 비동기 작업 처리를 위한 std::future
 #include <memory>    // 스마트 포인터 사용
+#include <mutex>     // 시선 필터 교체 보호
 #include <string>    // 문자열 처리
 #include <vector>    // 벡터 자료구조
 
 #include "eyedid/gaze_tracker.h"   // GazeTracker 클래스 및 관련 데이터 정의
 #include "eyedid/util/display.h"   // 디스플레이 정보 관련 유틸리티
 #include "opencv2/opencv.hpp"      // OpenCV 기능 사용
+#include "aoi_registry.h"          // 관심 영역(AOI) 판정
+#include "frame_envelope.h"        // 캡처 정보가 붙은 프레임
+#include "frame_tracker.h"         // SDK 대신 사용할 추적기
+#include "gaze_filter.h"           // 시선 평활화/예측 필터
+#include "gaze_sample.h"           // 시선 상세 데이터
+#include "latency_trace.h"         // 단계별 지연 추적
 #include "simple_signal.h"         // 신호-슬롯 기반 콜백 구현
+#include "telemetry.h"             // 추적 데이터 기록
+#include "window_geometry.h"       // 창 위치 캐시
 
 namespace sample {
 
@@ -32,13 +42,23 @@ class TrackerManager :
   TrackerManager() = default;
 
   /**
-   * GazeTracker를 초기화하는 함수
+   * GazeTracker(SDK)를 초기화하는 함수
+   * - EyedidFrameTracker를 만들어 initialize(std::unique_ptr<FrameTracker>)로 사용 (eyedid_frame_tracker.cc에 정의)
    * @param license_key 라이선스 키
    * @param options GazeTracker 초기화 옵션
    * @return 초기화 성공 여부
    */
   bool initialize(const std::string &license_key, const EyedidTrackerOptions& options);
 
+  /**
+   * SDK 대신 지정한 추적기로 초기화 (라이선스 없이 시험하거나 처리량을 측정할 때, 예: StubGazeTracker)
+   * - addFrame()으로 넘긴 프레임은 tracker로 전달되고, 결과는 SDK와 같은 경로(OnMetrics)로 처리됨
+   * - 캘리브레이션은 tracker가 지원할 때만 동작 (FrameTracker::startCollectSamples)
+   * @param tracker 프레임 추적기
+   * @return tracker가 nullptr이면 false
+   */
+  bool initialize(std::unique_ptr<FrameTracker> tracker);
+
   /**
    * 기본 카메라-디스플레이 변환기를 설정
    * @param display_info 디스플레이 정보
@@ -53,6 +73,16 @@ class TrackerManager :
    */
   bool addFrame(std::int64_t timestamp, const cv::Mat& frame);
 
+  /**
+   * 캡처 정보가 붙은 프레임을 추가
+   * - 캡처 시각(ms)을 SDK 타임스탬프로 사용 (이전 프레임과 같거나 이르면 1ms씩 늘려 겹치지 않게 함)
+   * - SDK 콜백에서 타임스탬프로 원본 프레임을 찾아 GazeSample의 frame_sequence/source_id/capture_ns를 채움
+   * - 한 스레드에서만 호출해야 함
+   * @param envelope RGB 프레임과 캡처 정보
+   * @return 프레임 추가 성공 여부
+   */
+  bool addFrame(const FrameEnvelope& envelope);
+
   /**
    * 전체 창 캘리브레이션 시작
    * @param target_num 캘리브레이션 포인트 개수
@@ -66,16 +96,38 @@ class TrackerManager :
    */
   void setWholeScreenToAttentionRegion(const eyedid::DisplayInfo& display_info);
 
+  /**
+   * on_gaze_로 보내기 전에 적용할 시선 필터 설정 (어느 스레드에서나 호출 가능, 다음 시선부터 적용)
+   * - 예: setGazeFilter(make_gaze_filter(OneEuroFilter()))
+   * - on_gaze_sample_과 관심 영역 판정에는 원본 좌표를 사용
+   * @param filter 시선 필터 (nullptr이면 필터 없음)
+   */
+  void setGazeFilter(std::unique_ptr<GazeFilter> filter);
+
   // ==== 신호(signal) 정의 ====
 
   /**
-   * 시선 데이터 전달 신호
+   * SDK 추적 데이터 전달 신호 (OnMetrics마다 SDK 콜백 스레드에서 발행)
+   * - 기록/분석 등 원본 데이터가 필요한 곳에서 사용
+   */
+  signal<void(std::uint64_t, const EyedidGazeData&, const EyedidFaceData&,
+              const EyedidBlinkData&, const EyedidUserStatusData&)> on_metrics_;
+
+  /**
+   * 시선 데이터 전달 신호 (setGazeFilter()로 설정한 필터를 거친 좌표)
    * @param x 시선 x 좌표
    * @param y 시선 y 좌표
    * @param is_tracking 시선 추적 여부
    */
   signal<void(int, int, bool)> on_gaze_;
 
+  /**
+   * 시선 상세 데이터 전달 신호 (SDK 콜백 스레드에서 발행)
+   * - 고정 시선 좌표와 눈의 움직임 상태가 필요한 곳(히트맵, 고정/도약 통계 등)에서 사용
+   * @param sample 시선 상세 데이터
+   */
+  signal<void(const GazeSample&)> on_gaze_sample_;
+
   /**
    * 캘리브레이션 진행률 신호
    * @param progress 캘리브레이션 진행률(0.0 ~ 1.0)
@@ -105,6 +157,28 @@ class TrackerManager :
    */
   std::string window_name_;
 
+  /**
+   * 얼굴/눈 깜박임/주의/졸음 데이터 기록 파이프라인
+   * - SDK 콜백 스레드에서는 레코드를 큐에 넣기만 하고, 출력은 기록 스레드에서 수행
+   * - start()로 싱크를 지정하기 전에는 기록하지 않음
+   */
+  TelemetryPipeline& telemetry() { return telemetry_; }
+
+  /**
+   * window_name_ 창의 위치 캐시
+   * - 시선/캘리브레이션 좌표를 창 기준으로 바꿀 때 창 시스템 대신 이 값을 사용
+   * - GUI 스레드에서 주기적으로 refresh(window_name_)를 호출해야 함
+   */
+  WindowGeometryCache& window_geometry() { return window_geometry_; }
+
+  /**
+   * 관심 영역(AOI) 등록 및 판정
+   * - 영역은 창 기준 좌표로 등록 (on_gaze_와 같은 좌표계)
+   * - 시선마다 SDK 콜백 스레드에서 판정하고 on_enter_/on_leave_/on_dwell_ 신호를 발행
+   *   (느린 처리는 실행기(Executor)에 연결)
+   */
+  AoiRegistry& aoi() { return aoi_; }
+
  private:
   // ==== ITrackingCallback 구현 ====
 
@@ -162,9 +236,75 @@ class TrackerManager :
   // ==== 내부 멤버 변수 ====
 
   /**
-   * GazeTracker 객체
+   * 추적 데이터 기록 파이프라인
+   * frame_tracker_보다 먼저 선언하여 SDK 콜백이 멈춘 뒤에 소멸되도록 함
+   */
+  TelemetryPipeline telemetry_;
+
+  /**
+   * OnMetrics 한 번 동안 각 처리 메서드가 채우는 레코드 (SDK 콜백 스레드 전용)
+   */
+  TelemetryRecord record_;
+
+  /**
+   * 창 위치 캐시 (GUI 스레드에서 갱신, SDK 콜백 스레드에서 읽기)
+   */
+  WindowGeometryCache window_geometry_;
+
+  /**
+   * 관심 영역 판정 (commit은 어느 스레드에서나, 판정은 SDK 콜백 스레드에서)
+   * frame_tracker_보다 먼저 선언하여 SDK 콜백이 멈춘 뒤에 소멸되도록 함
+   */
+  AoiRegistry aoi_;
+
+  /**
+   * 대기 중인 시선 필터로 교체 (SDK 콜백 스레드)
+   */
+  void swapGazeFilter();
+
+  /**
+   * on_gaze_ 앞의 시선 필터 (SDK 콜백 스레드 전용, 시선마다 잠그지 않음)
+   * - setGazeFilter()는 pending_gaze_filter_에 넣고 gaze_filter_pending_을 켬
+   * - SDK 콜백 스레드는 시선마다 gaze_filter_pending_만 읽고, 켜져 있을 때만 잠가서 교체
+   */
+  std::unique_ptr<GazeFilter> gaze_filter_;
+  std::unique_ptr<GazeFilter> pending_gaze_filter_; // gaze_filter_mutex_로 보호
+  std::atomic_bool gaze_filter_pending_{false};
+  std::mutex gaze_filter_mutex_;
+
+  // SDK에 넘긴 프레임의 캡처 정보 (SDK 타임스탬프로 찾음)
+  struct FrameInfo {
+    std::uint64_t timestamp = 0; // SDK 타임스탬프 (ms)
+    std::uint64_t sequence = 0;
+    std::uint32_t source_id = 0;
+    std::int64_t capture_ns = 0;
+  };
+
+  static constexpr std::size_t kFrameInfoCount = 32; // SDK가 처리 중일 수 있는 프레임 수보다 넉넉하게 둠
+
+  /**
+   * 타임스탬프로 캡처 정보 찾기 (SDK 콜백 스레드)
+   * @return 찾지 못하면 false (오래되어 덮어쓰였거나 addFrame(timestamp, frame)으로 넣은 프레임)
+   */
+  bool findFrame(std::uint64_t timestamp, FrameInfo* info);
+
+  /**
+   * addFrame(FrameEnvelope)로 넘긴 최근 프레임의 캡처 정보 (원형 버퍼, frames_mutex_로 보호)
+   */
+  FrameInfo frames_[kFrameInfoCount];
+  std::size_t frames_next_ = 0;
+  std::uint64_t last_timestamp_ = 0; // 마지막으로 넘긴 SDK 타임스탬프 (addFrame 스레드 전용)
+  std::mutex frames_mutex_;
+
+  /**
+   * OnMetrics 한 번 동안의 원본 프레임 정보 (SDK 콜백 스레드 전용)
+   */
+  FrameInfo frame_info_;
+
+  /**
+   * 프레임 추적기 (SDK는 EyedidFrameTracker, initialize() 전에는 nullptr)
    */
-  eyedid::GazeTracker gaze_tracker_;
+  std::unique_ptr<FrameTracker> frame_tracker_;
 
   /**
    * 비동기 캘리브레이션 처리 작업
@@ -0,0 +1,70 @@
+#ifndef EYEDID_CPP_SAMPLE_TRIPLE_BUFFER_H_
+#define EYEDID_CPP_SAMPLE_TRIPLE_BUFFER_H_
+
+#include <atomic>
+
+namespace sample {
+
+/**
+ * TripleBuffer 클래스:
+ * - 작성자 1개와 독자 1개가 잠금 없이 최신 값을 주고받는 트리플 버퍼
+ * - 작성자는 back()을 채운 뒤 publish()로 공개하고,
+ *   독자는 acquire()로 가장 최근에 공개된 값을 front()로 가져옴
+ * - 독자가 가져가기 전에 다시 공개되면 이전 값은 버려짐 (항상 최신 값만 유지)
+ * - 작성자가 여럿이면 작성자끼리는 외부에서 직렬화해야 함
+ *
+ * @tparam T 저장할 값 타입 (기본 생성 가능해야 함)
+ */
+template<typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() = default;
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // 작성자 전용 슬롯
+  T& back() { return slots_[back_]; }
+
+  /**
+   * back()의 값을 공개하고 새 back() 슬롯을 받음
+   * - 새 back() 슬롯에는 이전에 공개되었던 값이 남아 있음
+   * @return 독자가 읽지 않은 값을 덮어썼으면 true
+   */
+  bool publish() {
+    const int previous = shared_.exchange(back_ | kFresh);
+    back_ = previous & kIndexMask;
+    return (previous & kFresh) != 0;
+  }
+
+  // 독자가 아직 가져가지 않은 값이 있는지 확인
+  bool fresh() const { return (shared_.load() & kFresh) != 0; }
+
+  /**
+   * 가장 최근에 공개된 값을 front()로 가져옴
+   * @return 새 값을 가져왔으면 true, 새 값이 없으면 false (front()는 이전 값 유지)
+   */
+  bool acquire() {
+    if (!fresh())
+      return false;
+    front_ = shared_.exchange(front_) & kIndexMask;
+    return true;
+  }
+
+  // 독자 전용 슬롯
+  T& front() { return slots_[front_]; }
+  const T& front() const { return slots_[front_]; }
+
+ private:
+  static constexpr int kIndexMask = 0x3; // 공유 슬롯 인덱스
+  static constexpr int kFresh = 0x4;     // 공유 슬롯에 독자가 읽지 않은 값이 있음
+
+  T slots_[3];
+  int back_ = 0;               // 작성자 전용 슬롯 인덱스
+  int front_ = 1;              // 독자 전용 슬롯 인덱스
+  std::atomic_int shared_{2};  // 작성자와 독자가 교환하는 슬롯 (인덱스 | kFresh)
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_TRIPLE_BUFFER_H_
@@ -0,0 +1,54 @@
+#ifndef EYEDID_CPP_SAMPLE_VERSIONED_H_
+#define EYEDID_CPP_SAMPLE_VERSIONED_H_
+
+#include <cstdint>
+
+namespace sample {
+
+/**
+ * Versioned 클래스:
+ * - 값과 변경 번호(version)를 함께 보관하는 래퍼
+ * - 읽기는 *, ->로 하고, 변경은 write()로만 하며 write()를 부를 때마다 version이 올라감
+ * - 같은 원본에서 복사한 값끼리는 version만 비교하여 내용이 같은지 알 수 있음
+ *   (예: View는 바뀐 부분만 스냅샷에 복사하고, 바뀌지 않은 부분은 다시 그릴 영역 비교를 건너뜀)
+ * - write()가 반환한 참조는 보관하지 말 것 (보관한 참조로 바꾸면 version이 오르지 않음)
+ *
+ * @tparam T 저장할 값 타입 (기본 생성 및 복사 대입 가능해야 함)
+ */
+template<typename T>
+class Versioned {
+ public:
+  Versioned() = default;
+
+  const T& operator*() const { return value_; }
+  const T* operator->() const { return &value_; }
+
+  // 변경할 값 (version을 올림)
+  T& write() {
+    ++version_;
+    return value_;
+  }
+
+  std::uint64_t version() const { return version_; }
+
+  /**
+   * other와 version이 다를 때만 값을 복사
+   * - 복사 대입을 사용하므로 대상의 용량과 캐시(예: Text의 글자 마스크)가 유지됨
+   * @return 복사했으면 true
+   */
+  bool assign_if_changed(const Versioned& other) {
+    if (version_ == other.version_)
+      return false;
+    value_ = other.value_;
+    version_ = other.version_;
+    return true;
+  }
+
+ private:
+  T value_;
+  std::uint64_t version_ = 0;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_VERSIONED_H_
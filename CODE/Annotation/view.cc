@@ -6,35 +6,129 @@
 
 namespace sample {
 
+constexpr std::chrono::microseconds View::kContentionThreshold;
+constexpr double View::kFullRepaintRatio;
+
 // View 클래스 생성자
-// 주어진 너비와 높이로 배경 이미지를 초기화하고, 윈도우 이름을 설정한 뒤, OpenCV 창을 생성하고 초기 요소를 설정함
-View::View(int width, int height, std::string windowName)
-: background_(height, width, CV_8UC3, {0, 0, 0}), // 배경 이미지를 검정색으로 초기화
-  window_name_(std::move(windowName)) { // 윈도우 이름을 설정 (std::move로 효율적으로 전달)
-  cv::namedWindow(window_name_); // OpenCV 윈도우 생성
-  initElements(); // 화면에 표시할 기본 요소 초기화
+// OpenCV 창에 출력하는 기본 방식 사용
+View::View(int width, int height, std::string windowName, SyncMode sync_mode)
+: View(width, height, std::move(windowName), std::unique_ptr<ViewBackend>(new WindowViewBackend()), sync_mode) {}
+
+// 출력 방식을 지정하는 생성자
+// 주어진 너비와 높이로 배경 이미지를 초기화하고, 윈도우 이름을 설정한 뒤, 출력을 준비하고 초기 요소를 설정함
+View::View(int width, int height, std::string windowName, std::unique_ptr<ViewBackend> backend, SyncMode sync_mode)
+: window_name_(std::move(windowName)), // 윈도우 이름을 설정 (std::move로 효율적으로 전달)
+  background_(height, width, CV_8UC3, {0, 0, 0}), // 배경 이미지를 검정색으로 초기화
+  backend_(std::move(backend)),
+  sync_mode_(sync_mode) {
+  backend_->open(window_name_); // 창 생성 (헤드리스면 아무것도 하지 않음)
+  update([this](ViewState& state) {
+    initElements(state); // 화면에 표시할 기본 요소 초기화 (kSnapshot이면 첫 스냅샷 공개)
+  });
+}
+
+View::~View() {
+  expire_connections(); // 멤버가 해제되기 전에 슬롯 호출을 멈춤
 }
 
 // 사용자의 시선을 나타내는 점의 좌표를 설정
 void View::setPoint(int x, int y) {
-  gaze_point_.center = {x, y}; // 중심 좌표 설정
+  update([=](ViewState& state) {
+    state.gaze_point.center = {x, y}; // 중심 좌표 설정
+  });
 }
 
 // 화면에 표시할 프레임을 설정
 void View::setFrame(const cv::Mat& frame) {
-  frame_.buffer = frame; // 프레임 데이터를 내부 버퍼에 복사
+  update([&](ViewState& state) {
+    state.frame.buffer = frame; // 프레임 헤더를 대입 (픽셀 데이터는 참조 공유)
+  });
+}
+
+// 프레임이 그려지는 크기 (잠금 없이 update()가 기록한 값을 읽음)
+cv::Size View::frameSize() const {
+  const auto packed = frame_size_.load(std::memory_order_relaxed);
+  return cv::Size(static_cast<int>(packed >> 32), static_cast<int>(packed & 0xffffffffu));
+}
+
+// 동기화 방식 변경
+// - kSnapshot으로 바뀌면 현재 상태를 바로 공개하여 draw()가 최신 상태를 그리도록 함
+void View::setSyncMode(SyncMode sync_mode) {
+  write_lock_guard lock(write_mutex());
+  sync_mode_.store(sync_mode);
+  if (sync_mode == SyncMode::kSnapshot)
+    publishSnapshot();
+}
+
+// 부분 갱신 사용 여부 설정
+void View::setDamageTracking(bool enabled) {
+  damage_tracking_.store(enabled);
+  invalidate();
+}
+
+// 바뀐 것이 없을 때 출력 생략 여부 설정
+void View::setSkipUnchangedPresent(bool skip) {
+  skip_unchanged_present_.store(skip);
+}
+
+// 다음 draw()에서 화면 전체를 다시 그리도록 요청
+void View::invalidate() {
+  invalidated_.store(true);
+}
+
+// 그리기 통계 반환
+View::RenderStats View::renderStats() const {
+  RenderStats stats;
+  stats.frames = frames_.load(std::memory_order_relaxed);
+  stats.full_repaints = full_repaints_.load(std::memory_order_relaxed);
+  stats.partial_repaints = partial_repaints_.load(std::memory_order_relaxed);
+  stats.clean_frames = clean_frames_.load(std::memory_order_relaxed);
+  stats.presents_skipped = presents_skipped_.load(std::memory_order_relaxed);
+  stats.last_damage_rects = last_damage_rects_.load(std::memory_order_relaxed);
+  stats.last_repainted_pixels = last_repainted_pixels_.load(std::memory_order_relaxed);
+  stats.total_repainted_pixels = total_repainted_pixels_.load(std::memory_order_relaxed);
+  stats.last_render_us = last_render_us_.load(std::memory_order_relaxed);
+  stats.total_render_us = total_render_us_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// 동기화 통계 반환
+View::SyncStats View::syncStats() const {
+  SyncStats stats;
+  stats.writes = writes_.load(std::memory_order_relaxed);
+  stats.write_contentions = write_contentions_.load(std::memory_order_relaxed);
+  stats.write_wait_total_us = write_wait_total_us_.load(std::memory_order_relaxed);
+  stats.write_wait_max_us = write_wait_max_us_.load(std::memory_order_relaxed);
+  stats.draws = draws_.load(std::memory_order_relaxed);
+  stats.draw_contentions = draw_contentions_.load(std::memory_order_relaxed);
+  stats.draw_wait_total_us = draw_wait_total_us_.load(std::memory_order_relaxed);
+  stats.draw_wait_max_us = draw_wait_max_us_.load(std::memory_order_relaxed);
+  stats.snapshots_published = snapshots_published_.load(std::memory_order_relaxed);
+  stats.snapshots_dropped = snapshots_dropped_.load(std::memory_order_relaxed);
+  return stats;
 }
 
 // 화면을 그리는 메서드
+// - 바뀐 것이 없고 출력 생략이 설정되어 있으면 키 입력만 처리
+// - 그리기 시간은 RenderStats에 기록 (텍스트 캐시 등 그리기 비용 비교용)
 int View::draw(int wait_ms) {
-  clearBackground(); // 배경 초기화 (검정색으로 지움)
-  drawElements(); // 요소들을 화면에 그림
+  const auto start = std::chrono::steady_clock::now();
+  const bool changed = drawElements(); // 바뀐 요소들을 화면에 그림
+  const auto render_us = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  last_render_us_.store(render_us, std::memory_order_relaxed);
+  total_render_us_.fetch_add(render_us, std::memory_order_relaxed);
+
+  if (!changed && skip_unchanged_present_.load(std::memory_order_relaxed)) {
+    presents_skipped_.fetch_add(1, std::memory_order_relaxed);
+    return backend_->poll(window_name_, wait_ms);
+  }
   return drawWindow(wait_ms); // 화면 출력 및 키 입력 대기
 }
 
 // 윈도우를 닫는 메서드
 void View::closeWindow() {
-  cv::destroyWindow(window_name_); // OpenCV 윈도우 닫기
+  backend_->close(window_name_); // 윈도우 닫기
 }
 
 // 윈도우 이름 반환 (const 참조로 반환하여 불필요한 복사를 방지)
@@ -43,33 +137,34 @@ const std::string& View::getWindowName() const {
 }
 
 // 화면에 그릴 요소들을 초기화하는 메서드
-void View::initElements() {
+void View::initElements(ViewState& state) {
   // 시선 표시점 설정
-  gaze_point_.color = {0, 220, 220}; // 청록색으로 설정
+  state.gaze_point.color = {0, 220, 220}; // 청록색으로 설정
 
   // 캘리브레이션 점 초기화
-  calibration_point_.visible = false; // 기본적으로 보이지 않음
-  calibration_point_.color = {0, 0, 255}; // 빨간색으로 설정
-  calibration_point_.radius = 50; // 반지름 설정
+  state.calibration_point.visible = false; // 기본적으로 보이지 않음
+  state.calibration_point.color = {0, 0, 255}; // 빨간색으로 설정
+  state.calibration_point.radius = 50; // 반지름 설정
 
   // 캘리브레이션 설명 초기화
-  calibration_desc_.text = "Stare at the red circle until it disappears or moves to other place.";
-  calibration_desc_.org = {background_.cols / 2, background_.rows / 2}; // 중앙에 위치
-  calibration_desc_.visible = false; // 기본적으로 보이지 않음
+  state.calibration_desc.text = "Stare at the red circle until it disappears or moves to other place.";
+  state.calibration_desc.org = {background_.cols / 2, background_.rows / 2}; // 중앙에 위치
+  state.calibration_desc.visible = false; // 기본적으로 보이지 않음
 
   // 프레임 기본 크기 설정
-  frame_.size = {480, 320};
+  state.frame.size = {480, 320};
 
   // 화면 하단 설명 초기화
-  desc_.resize(2); // 설명 텍스트 2개를 저장
-  desc_[0].text = "Press ESC to exit program, Press 'C' to start calibration"; // 첫 번째 설명
-  desc_[1].text = "Do not resize the window manually after created"; // 두 번째 설명
-  desc_[1].color = {0, 0, 220}; // 파란색으로 표시
+  auto& desc = state.desc.write();
+  desc.resize(2); // 설명 텍스트 2개를 저장
+  desc[0].text = "Press ESC to exit program, Press 'C' to start calibration"; // 첫 번째 설명
+  desc[1].text = "Do not resize the window manually after created"; // 두 번째 설명
+  desc[1].color = {0, 0, 220}; // 파란색으로 표시
 
   // 설명 텍스트 위치와 글자 크기 설정
-  for (int i = 0; i < desc_.size(); ++i) {
-    desc_[desc_.size() - 1 - i].fontScale = 1.5; // 글자 크기
-    desc_[desc_.size() - 1 - i].org = {50, background_.rows - 50 * (i + 1)}; // 위치
+  for (int i = 0; i < desc.size(); ++i) {
+    desc[desc.size() - 1 - i].fontScale = 1.5; // 글자 크기
+    desc[desc.size() - 1 - i].org = {50, background_.rows - 50 * (i + 1)}; // 위치
   }
 }
 
@@ -79,24 +174,203 @@ void View::clearBackground() {
   // OpenCV의 메모리 데이터 직접 초기화하여 모든 픽셀을 검정색으로 설정
 }
 
-// 화면에 그릴 요소들을 순서대로 그리는 메서드
-void View::drawElements() {
+// 화면에 그릴 요소들을 그리는 메서드
+// - kSnapshot: 잠금 없이 가장 최근 스냅샷을 그림 (새 스냅샷이 없으면 이전 스냅샷을 다시 그림)
+// - kLocked: 읽기 락을 잡은 채로 현재 상태를 그림
+bool View::drawElements() {
+  draws_.fetch_add(1, std::memory_order_relaxed);
+
+  if (sync_mode_.load(std::memory_order_relaxed) == SyncMode::kSnapshot) {
+    snapshots_.acquire();
+    return renderState(snapshots_.front());
+  }
+
+  const auto start = std::chrono::steady_clock::now();
   read_lock_guard lock(read_mutex()); // 멀티스레드 환경에서 안전한 읽기 보호
+  recordWait(std::chrono::steady_clock::now() - start,
+             draw_contentions_, draw_wait_total_us_, draw_wait_max_us_);
+  return renderState(state_);
+}
 
-  // 각 요소를 배경에 그리기
-  drawables::draw_if(frame_, &background_); // 프레임 그리기
-  drawables::draw_if(gaze_point_, &background_); // 시선 점 그리기
-  drawables::draw_if(calibration_point_, &background_); // 캘리브레이션 점 그리기
-  drawables::draw_if(calibration_desc_, &background_); // 캘리브레이션 설명 그리기
-  for (const auto& desc : desc_)
+// 이전에 그린 상태와 비교하여 필요한 부분만 그리는 메서드
+// - 처음 그리거나, 부분 갱신을 사용하지 않거나, 바뀐 영역이 넓으면 화면 전체를 다시 그림
+// - 그 외에는 바뀐 영역만 지우고, 그 영역과 겹치는 요소를 원래 순서대로 다시 그림
+bool View::renderState(const ViewState& state) {
+  frames_.fetch_add(1, std::memory_order_relaxed);
+  const bool tracking = damage_tracking_.load(std::memory_order_relaxed);
+  const auto screen = cv::Rect(0, 0, background_.cols, background_.rows);
+  const auto screen_area = static_cast<std::uint64_t>(screen.area());
+
+  bool full = !tracking || !drawn_valid_ || invalidated_.exchange(false);
+  std::uint64_t pixels = 0;
+  if (!full) {
+    collectDamage(state);
+    if (damage_.empty()) {
+      clean_frames_.fetch_add(1, std::memory_order_relaxed);
+      last_damage_rects_.store(0, std::memory_order_relaxed);
+      last_repainted_pixels_.store(0, std::memory_order_relaxed);
+      return false;
+    }
+
+    mergeDamage();
+    for (const auto& rect : damage_)
+      pixels += static_cast<std::uint64_t>(rect.area());
+    full = pixels > screen_area * kFullRepaintRatio;
+  }
+
+  if (full) {
+    clearBackground(); // 배경 초기화 (검정색으로 지움)
+    drawState(state);
+    pixels = screen_area;
+    damage_.assign(1, screen);
+    full_repaints_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    for (const auto& rect : damage_) {
+      background_(rect).setTo(cv::Scalar(0, 0, 0)); // 영역만 검정색으로 지움
+      drawState(state, rect);
+    }
+    partial_repaints_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  last_damage_rects_.store(damage_.size(), std::memory_order_relaxed);
+  last_repainted_pixels_.store(pixels, std::memory_order_relaxed);
+  total_repainted_pixels_.fetch_add(pixels, std::memory_order_relaxed);
+
+  if (tracking)
+    copyState(state, &drawn_); // 다음 비교를 위해 보관 (바뀐 부분만 복사, 문자열/벡터 용량 재사용)
+  drawn_valid_ = tracking;
+  return true;
+}
+
+// 바뀐 요소의 이전 영역과 현재 영역을 모음 (화면 밖은 잘라냄)
+void View::collectDamage(const ViewState& state) {
+  damage_.clear();
+  addDamage(drawn_.frame, state.frame);
+  addDamage(drawn_.gaze_point, state.gaze_point);
+  addDamage(drawn_.calibration_point, state.calibration_point);
+  addDamage(drawn_.calibration_desc, state.calibration_desc);
+  if (drawn_.scene.version() != state.scene.version()) // version이 같으면 바뀐 요소가 없음
+    state.scene->collect_damage(*drawn_.scene, &damage_);
+
+  if (drawn_.desc.version() != state.desc.version()) {
+    const auto& before = *drawn_.desc;
+    const auto& after = *state.desc;
+    const auto n = std::max(before.size(), after.size());
+    for (std::size_t i = 0; i < n; ++i) {
+      if (i >= after.size()) { // 사라진 설명
+        if (before[i].visible)
+          damage_.push_back(before[i].bounds());
+      } else if (i >= before.size()) { // 새로 생긴 설명
+        if (after[i].visible)
+          damage_.push_back(after[i].bounds());
+      } else {
+        addDamage(before[i], after[i]);
+      }
+    }
+  }
+
+  const auto screen = cv::Rect(0, 0, background_.cols, background_.rows);
+  for (auto& rect : damage_)
+    rect &= screen;
+  damage_.erase(std::remove_if(damage_.begin(), damage_.end(),
+                               [](const cv::Rect& rect) { return rect.empty(); }),
+                damage_.end());
+}
+
+// 겹치는 영역과, 합쳐도 두 영역의 넓이 합보다 커지지 않는 영역을 하나로 합침
+// - 같은 픽셀을 두 번 지우고 그리지 않도록 함 (영역 수가 적으므로 단순 반복)
+void View::mergeDamage() {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (std::size_t i = 0; i < damage_.size() && !merged; ++i) {
+      for (std::size_t j = i + 1; j < damage_.size(); ++j) {
+        const auto joined = damage_[i] | damage_[j];
+        if (!(damage_[i] & damage_[j]).empty() || joined.area() <= damage_[i].area() + damage_[j].area()) {
+          damage_[i] = joined;
+          damage_.erase(damage_.begin() + j);
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+// 화면 요소를 순서대로 배경에 그리는 메서드
+void View::drawState(const ViewState& state) {
+  drawables::draw_if(state.frame, &background_); // 프레임 그리기
+  state.scene->draw(&background_); // 장면 요소 그리기
+  drawables::draw_if(state.gaze_point, &background_); // 시선 점 그리기
+  drawables::draw_if(state.calibration_point, &background_); // 캘리브레이션 점 그리기
+  drawables::draw_if(state.calibration_desc, &background_); // 캘리브레이션 설명 그리기
+  for (const auto& desc : *state.desc)
     drawables::draw_if(desc, &background_); // 설명 텍스트 그리기
 }
 
+// 화면 요소 중 clip 영역과 겹치는 부분만 같은 순서로 그리는 메서드
+void View::drawState(const ViewState& state, const cv::Rect& clip) {
+  drawables::draw_if(state.frame, &background_, clip);
+  state.scene->draw(&background_, clip);
+  drawables::draw_if(state.gaze_point, &background_, clip);
+  drawables::draw_if(state.calibration_point, &background_, clip);
+  drawables::draw_if(state.calibration_desc, &background_, clip);
+  for (const auto& desc : *state.desc)
+    drawables::draw_if(desc, &background_, clip);
+}
+
+// 현재 상태를 스냅샷으로 공개하는 메서드
+// - 스냅샷 슬롯을 재사용하므로 문자열/벡터 용량이 유지되어 반복 할당이 없음
+// - 시선 점/프레임 같은 작은 요소만 매번 복사하고, 설명과 장면은 슬롯에 있는 것과 version이 다를 때만 복사
+void View::publishSnapshot() {
+  copyState(state_, &snapshots_.back());
+  if (snapshots_.publish())
+    snapshots_dropped_.fetch_add(1, std::memory_order_relaxed);
+  snapshots_published_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// src에서 바뀐 부분만 dst로 복사하는 메서드
+// - dst가 같은 원본(state_)에서 복사된 상태이므로 version이 같으면 내용도 같음
+void View::copyState(const ViewState& src, ViewState* dst) {
+  dst->gaze_point = src.gaze_point;
+  dst->calibration_point = src.calibration_point;
+  dst->calibration_desc = src.calibration_desc;
+  dst->frame = src.frame;
+  dst->desc.assign_if_changed(src.desc);
+  dst->scene.assign_if_changed(src.scene);
+}
+
+// 프레임 크기를 하나의 정수로 묶는 메서드
+std::uint64_t View::packSize(cv::Size size) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(size.width)) << 32) |
+         static_cast<std::uint32_t>(size.height);
+}
+
+// 락 대기 시간을 통계에 기록하는 메서드
+void View::recordWait(std::chrono::steady_clock::duration wait,
+                      std::atomic<std::uint64_t>& contentions,
+                      std::atomic<std::int64_t>& total_us,
+                      std::atomic<std::int64_t>& max_us) {
+  const auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(wait).count();
+  if (wait >= kContentionThreshold)
+    contentions.fetch_add(1, std::memory_order_relaxed);
+  total_us.fetch_add(wait_us, std::memory_order_relaxed);
+
+  auto current = max_us.load(std::memory_order_relaxed);
+  while (current < wait_us && !max_us.compare_exchange_weak(current, wait_us, std::memory_order_relaxed)) {}
+}
+
 // 화면을 출력하고 키 입력을 기다리는 메서드
+// - 새 시선이 처음 화면에 나갈 때만 프레임 번호를 붙여 캡처 → 화면 지연을 기록
 int View::drawWindow(int wait_ms) {
-  cv::imshow(window_name_, background_); // 배경 이미지를 윈도우에 표시
-  int key = cv::waitKey(wait_ms); // 주어진 시간(ms) 동안 키 입력 대기
-  return key; // 입력된 키 값을 반환
+  auto frame = LatencyTracer::instance().latest_frame(TraceStage::kGaze);
+  if (frame == presented_frame_)
+    frame = 0;
+  else
+    presented_frame_ = frame;
+
+  TraceSpan span(TraceStage::kPresent, frame);
+  return backend_->present(window_name_, background_, wait_ms); // 입력된 키 값을 반환
 }
 
 } // namespace sample
@@ -7,12 +7,22 @@
 #ifndef EYEDID_CPP_SAMPLE_VIEW_H_
 #define EYEDID_CPP_SAMPLE_VIEW_H_
 
+#include <atomic> // 동기화 통계를 위한 원자 변수
+#include <chrono> // 잠금 대기 시간 측정
+#include <cstdint> // 고정 크기 정수 타입
+#include <memory> // 출력 방식(ViewBackend) 소유
 #include <string> // 문자열 처리를 위한 헤더
 #include <vector> // 텍스트 설명과 같은 요소들을 저장할 벡터 자료구조 포함
 
 #include "opencv2/opencv.hpp" // OpenCV 라이브러리 사용
 #include "drawables.h" // 화면에 그릴 도형 및 텍스트 요소에 대한 정의 포함
+#include "scene.h" // z 순서로 그리는 추가 화면 요소
+#include "latency_trace.h" // 화면 출력 지연 추적
 #include "priority_mutex.h" // 동기화를 위한 사용자 정의 뮤텍스 정의 포함
+#include "simple_signal.h" // 시그널 연결 추적 (trackable)
+#include "triple_buffer.h" // 잠금 없는 스냅샷 전달을 위한 트리플 버퍼
+#include "versioned.h" // 바뀐 부분만 복사하기 위한 변경 번호
+#include "view_backend.h" // 화면 출력 방식 (창 / 헤드리스)
 
 namespace sample {
 
@@ -26,20 +36,110 @@ using read_unique_lock = std::unique_lock<typename PriorityMutex::high_mutex_typ
 using write_lock_guard = std::lock_guard<typename PriorityMutex::low_mutex_type>;
 using write_unique_lock = std::unique_lock<typename PriorityMutex::low_mutex_type>;
 
+/**
+ * View가 그리는 화면 요소 상태:
+ * - gaze_point: 시선을 나타내는 원
+ * - calibration_point: 캘리브레이션을 위한 빨간색 원
+ * - calibration_desc: 캘리브레이션 시 보여주는 텍스트
+ * - frame: 카메라로 받은 프레임 이미지
+ * - desc: 화면 하단에 표시할 설명 텍스트 목록
+ * - scene: 그 밖의 화면 요소 (프레임 위, 시선 점 아래에 레이어/z 순서로 그림)
+ *
+ * desc와 scene은 크기가 크고 자주 바뀌지 않으므로 Versioned로 보관:
+ * - 읽기는 state.desc->size(), *state.scene처럼 하고, 변경은 state.desc.write()[0].text = ...처럼 write()로 함
+ * - 스냅샷과 부분 갱신용 이전 상태에는 version이 바뀐 경우에만 복사함
+ */
+struct ViewState {
+  drawables::Circle gaze_point;
+  drawables::Circle calibration_point;
+  drawables::Text calibration_desc;
+  drawables::Image frame;
+  Versioned<std::vector<drawables::Text>> desc;
+  Versioned<drawables::Scene> scene;
+};
+
 /**
  * View 클래스 정의:
  * - OpenCV를 기반으로 창을 생성하고 화면 요소를 표시합니다.
  * - 시선 추적 및 캘리브레이션 관련 화면 요소도 처리합니다.
+ * - 화면 요소는 update()로만 변경하며, 변경 함수는 쓰기 락 아래에서 실행됩니다.
+ * - 그린 화면의 출력은 ViewBackend가 담당합니다 (기본: OpenCV 창, HeadlessViewBackend: 창 없이 파일/스트림/버림).
+ * - trackable이므로 시그널에 View를 추적 객체로 연결하면, View가 해제될 때 연결이 자동으로 멈춥니다.
  */
-class View {
+class View : public trackable {
  public:
+  /**
+   * 화면 요소 동기화 방식
+   * - kLocked: draw()가 읽기 락을 잡은 채로 화면 요소를 그림 (기존 방식)
+   * - kSnapshot: update()가 변경된 상태의 스냅샷을 공개하고,
+   *              draw()는 잠금 없이 가장 최근 스냅샷을 그림 (RCU 방식)
+   */
+  enum class SyncMode {
+    kLocked,
+    kSnapshot,
+  };
+
+  /**
+   * 동기화 통계 (두 방식 비교용)
+   * - contention: 락 대기 시간이 kContentionThreshold를 넘은 횟수
+   */
+  struct SyncStats {
+    std::uint64_t writes = 0;              // update() 호출 수
+    std::uint64_t write_contentions = 0;   // 쓰기 락 경합 횟수
+    std::int64_t write_wait_total_us = 0;  // 쓰기 락 대기 시간 합계 (us)
+    std::int64_t write_wait_max_us = 0;    // 쓰기 락 최대 대기 시간 (us)
+    std::uint64_t draws = 0;               // draw() 호출 수
+    std::uint64_t draw_contentions = 0;    // 읽기 락 경합 횟수 (kLocked)
+    std::int64_t draw_wait_total_us = 0;   // 읽기 락 대기 시간 합계 (us)
+    std::int64_t draw_wait_max_us = 0;     // 읽기 락 최대 대기 시간 (us)
+    std::uint64_t snapshots_published = 0; // 공개된 스냅샷 수 (kSnapshot)
+    std::uint64_t snapshots_dropped = 0;   // 그려지기 전에 덮어쓰인 스냅샷 수 (kSnapshot)
+  };
+
+  static constexpr std::chrono::microseconds kContentionThreshold{1}; // 경합으로 볼 최소 대기 시간
+
+  /**
+   * 그리기 통계 (부분 갱신)
+   * - 부분 갱신: 이전에 그린 상태와 비교하여 바뀐 요소의 이전/현재 영역만 지우고 다시 그림
+   */
+  struct RenderStats {
+    std::uint64_t frames = 0;                 // draw() 호출 수
+    std::uint64_t full_repaints = 0;          // 화면 전체를 다시 그린 횟수
+    std::uint64_t partial_repaints = 0;       // 바뀐 영역만 다시 그린 횟수
+    std::uint64_t clean_frames = 0;           // 바뀐 것이 없어 그리지 않은 횟수
+    std::uint64_t presents_skipped = 0;       // 바뀐 것이 없어 출력(imshow)을 생략한 횟수
+    std::uint64_t last_damage_rects = 0;      // 마지막 draw()에서 다시 그린 영역 수
+    std::uint64_t last_repainted_pixels = 0;  // 마지막 draw()에서 다시 그린 픽셀 수
+    std::uint64_t total_repainted_pixels = 0; // 다시 그린 픽셀 수 합계
+    std::int64_t last_render_us = 0;          // 마지막 draw()의 그리기 시간 (출력 제외, us)
+    std::int64_t total_render_us = 0;         // 그리기 시간 합계 (us)
+  };
+
+  // 바뀐 영역이 화면의 이 비율을 넘으면 전체를 다시 그림 (영역별 처리보다 빠름)
+  static constexpr double kFullRepaintRatio = 0.5;
+
   /**
    * 생성자
    * @param width 창의 너비
    * @param height 창의 높이
    * @param windowName 창 이름
+   * @param sync_mode 화면 요소 동기화 방식
    */
-  View(int width, int height, std::string windowName);
+  View(int width, int height, std::string windowName, SyncMode sync_mode = SyncMode::kSnapshot);
+
+  /**
+   * 출력 방식을 지정하는 생성자
+   * @param width 화면의 너비
+   * @param height 화면의 높이
+   * @param windowName 창 이름
+   * @param backend 화면 출력 방식 (예: HeadlessViewBackend)
+   * @param sync_mode 화면 요소 동기화 방식
+   */
+  View(int width, int height, std::string windowName, std::unique_ptr<ViewBackend> backend,
+       SyncMode sync_mode = SyncMode::kSnapshot);
+
+  // 연결된 슬롯의 호출을 멈춘 뒤 해제 (호출 중인 슬롯이 끝날 때까지 대기)
+  ~View();
 
   /**
    * 시선 좌표를 설정하는 함수
@@ -54,10 +154,18 @@ class View {
    */
   void setFrame(const cv::Mat& frame);
 
+  /**
+   * 프레임이 그려지는 크기를 반환하는 함수
+   * - 프레임을 이 크기로 미리 맞춰 두면 그릴 때 크기 조정을 하지 않음
+   * - 잠금 없이 update()가 마지막으로 기록한 크기를 읽음
+   * @return 화면에 표시되는 프레임 크기
+   */
+  cv::Size frameSize() const;
+
   /**
    * 창을 그리는 함수
-   * @param wait_ms 키 입력 대기 시간 (기본값 10ms)
-   * @return 눌린 키 값
+   * @param wait_ms 키 입력 대기 시간 (기본값 10ms, 0 이하이면 기다리지 않음. 루프 주기는 FrameClock으로 조절)
+   * @return 눌린 키 값 (헤드리스 출력이면 항상 -1)
    */
   int draw(int wait_ms = 10);
 
@@ -73,18 +181,56 @@ class View {
   const std::string& getWindowName() const;
 
   /**
-   * 공용 멤버:
-   * - gaze_point_: 시선을 나타내는 원
-   * - calibration_point_: 캘리브레이션을 위한 빨간색 원
-   * - calibration_desc_: 캘리브레이션 시 보여주는 텍스트
-   * - frame_: 카메라로 받은 프레임 이미지
-   * - desc_: 화면 하단에 표시할 설명 텍스트 목록
+   * 화면 요소 변경
+   * - 쓰기 락 아래에서 func(ViewState&)를 호출하고, kSnapshot 방식이면 결과를 스냅샷으로 공개
+   * - 스냅샷에는 작은 요소만 매번 복사하고, desc와 scene은 write()로 바꾼 경우에만 복사함
+   * - 어느 스레드에서나 호출 가능
+   * - 스냅샷이 픽셀 데이터를 공유하므로 frame.buffer는 제자리에서 덮어쓰지 말고 새 버퍼를 대입해야 함
+   * @param func ViewState를 변경하는 함수
+   */
+  template<typename F>
+  void update(F&& func);
+
+  /**
+   * 동기화 방식 변경
+   * @param sync_mode 새 동기화 방식
+   */
+  void setSyncMode(SyncMode sync_mode);
+
+  /**
+   * 부분 갱신 사용 여부 설정 (기본값: 사용)
+   * @param enabled false이면 매번 화면 전체를 다시 그림 (기존 방식)
+   */
+  void setDamageTracking(bool enabled);
+
+  /**
+   * 바뀐 것이 없을 때 출력 생략 여부 설정 (기본값: 생략하지 않음)
+   * @param skip true이면 imshow 등 출력 없이 키 입력만 처리
+   */
+  void setSkipUnchangedPresent(bool skip);
+
+  /**
+   * 다음 draw()에서 화면 전체를 다시 그리도록 요청
+   */
+  void invalidate();
+
+  /**
+   * 그리기 통계 반환
+   * @return 부분 갱신 및 다시 그린 픽셀 통계
    */
-  drawables::Circle gaze_point_;
-  drawables::Circle calibration_point_;
-  drawables::Text calibration_desc_;
-  drawables::Image frame_;
-  std::vector<drawables::Text> desc_;
+  RenderStats renderStats() const;
+
+  /**
+   * 동기화 통계 반환
+   * @return 누적된 락 대기 및 스냅샷 통계
+   */
+  SyncStats syncStats() const;
+
+  /**
+   * 읽기/쓰기 락 통계 반환
+   * @return 우선순위별 잠금 획득 대기 시간 히스토그램
+   */
+  PriorityMutex::Stats lockStats() const { return mutex_.stats(); }
 
   /**
    * 쓰기 mutex에 대한 참조를 반환
@@ -99,16 +245,53 @@ class View {
    */
 
   // 화면 요소를 초기화하는 메서드
-  void initElements();
+  void initElements(ViewState& state);
+
+  // 현재 상태를 스냅샷으로 공개하는 메서드 (쓰기 락 아래에서 호출)
+  void publishSnapshot();
+
+  // src에서 바뀐 부분만 dst로 복사하는 메서드 (desc와 scene은 version이 다를 때만 복사)
+  static void copyState(const ViewState& src, ViewState* dst);
+
+  // 프레임 크기를 하나의 정수로 묶는 메서드 (frame_size_에 저장, 너비는 상위 32비트)
+  static std::uint64_t packSize(cv::Size size);
+
+  // 주어진 상태의 화면 요소를 그리는 메서드
+  void drawState(const ViewState& state);
+
+  // 주어진 상태의 화면 요소 중 clip 영역과 겹치는 부분만 그리는 메서드
+  void drawState(const ViewState& state, const cv::Rect& clip);
+
+  /**
+   * 이전에 그린 상태와 비교하여 필요한 부분만 그리는 메서드
+   * @return 화면이 바뀌었으면 true
+   */
+  bool renderState(const ViewState& state);
+
+  // 이전에 그린 상태(drawn_)와 비교하여 다시 그릴 영역(damage_)을 모으는 메서드
+  void collectDamage(const ViewState& state);
+
+  // 요소가 바뀌었으면 이전 영역과 현재 영역을 damage_에 추가
+  template<typename T>
+  void addDamage(const T& prev, const T& cur);
+
+  // 겹치거나 합쳐도 넓어지지 않는 영역을 합치는 메서드
+  void mergeDamage();
+
+  // 락 대기 시간을 통계에 기록하는 메서드
+  static void recordWait(std::chrono::steady_clock::duration wait,
+                         std::atomic<std::uint64_t>& contentions,
+                         std::atomic<std::int64_t>& total_us,
+                         std::atomic<std::int64_t>& max_us);
 
   // 배경 이미지를 초기화하는 메서드 (검정색으로 설정)
   void clearBackground();
 
-  // 등록된 화면 요소를 그리는 메서드
-  void drawElements();
+  // 등록된 화면 요소를 그리는 메서드 (화면이 바뀌었으면 true)
+  bool drawElements();
 
   /**
-   * 창을 표시하고 키 입력을 대기하는 메서드
+   * 화면을 출력 방식(backend_)으로 내보내는 메서드
    * @param wait_ms 키 입력 대기 시간(ms)
    * @return 눌린 키 값
    */
@@ -124,13 +307,83 @@ class View {
    * 비공용 멤버:
    * - window_name_: 창 이름
    * - background_: 화면 배경(cv::Mat 형식)
+   * - backend_: 화면 출력 방식
    * - mutex_: 동기화를 위한 우선순위 뮤텍스
+   * - state_: update()가 변경하는 화면 요소 상태 (쓰기 락으로 보호)
+   * - snapshots_: draw()에 전달할 상태 스냅샷
+   * - frame_size_: 잠금 없이 읽는 프레임 크기 (update()에서 갱신)
+   * - drawn_: 마지막으로 그린 상태 (부분 갱신 비교용, GUI 스레드에서만 사용)
+   * - damage_: 이번 draw()에서 다시 그릴 영역
    */
   std::string window_name_; // 창 이름
   cv::Mat background_; // 화면 배경 이미지
+  std::unique_ptr<ViewBackend> backend_; // 화면 출력 방식
   mutable PriorityMutex mutex_; // 동기화를 위한 mutable mutex
+  ViewState state_; // 화면 요소 상태
+  TripleBuffer<ViewState> snapshots_; // 잠금 없이 그리기 위한 상태 스냅샷
+  std::atomic<SyncMode> sync_mode_; // 현재 동기화 방식
+  std::atomic<std::uint64_t> frame_size_{0}; // frameSize()가 읽는 프레임 크기
+
+  // 부분 갱신
+  ViewState drawn_; // 마지막으로 그린 상태
+  bool drawn_valid_ = false; // drawn_이 화면 내용과 일치하는지 여부
+  std::uint64_t presented_frame_ = 0; // 마지막으로 화면에 낸 시선의 프레임 번호 (지연 추적용)
+  std::vector<cv::Rect> damage_; // 다시 그릴 영역 (용량 재사용)
+  std::atomic_bool damage_tracking_{true};
+  std::atomic_bool skip_unchanged_present_{false};
+  std::atomic_bool invalidated_{false};
+
+  // 동기화 통계
+  std::atomic<std::uint64_t> writes_{0};
+  std::atomic<std::uint64_t> write_contentions_{0};
+  std::atomic<std::int64_t> write_wait_total_us_{0};
+  std::atomic<std::int64_t> write_wait_max_us_{0};
+  std::atomic<std::uint64_t> draws_{0};
+  std::atomic<std::uint64_t> draw_contentions_{0};
+  std::atomic<std::int64_t> draw_wait_total_us_{0};
+  std::atomic<std::int64_t> draw_wait_max_us_{0};
+  std::atomic<std::uint64_t> snapshots_published_{0};
+  std::atomic<std::uint64_t> snapshots_dropped_{0};
+
+  // 그리기 통계
+  std::atomic<std::uint64_t> frames_{0};
+  std::atomic<std::uint64_t> full_repaints_{0};
+  std::atomic<std::uint64_t> partial_repaints_{0};
+  std::atomic<std::uint64_t> clean_frames_{0};
+  std::atomic<std::uint64_t> presents_skipped_{0};
+  std::atomic<std::uint64_t> last_damage_rects_{0};
+  std::atomic<std::uint64_t> last_repainted_pixels_{0};
+  std::atomic<std::uint64_t> total_repainted_pixels_{0};
+  std::atomic<std::int64_t> last_render_us_{0};
+  std::atomic<std::int64_t> total_render_us_{0};
 };
 
+template<typename T>
+void View::addDamage(const T& prev, const T& cur) {
+  if (prev == cur)
+    return;
+  if (prev.visible)
+    damage_.push_back(prev.bounds()); // 이전 위치 지우기
+  if (cur.visible)
+    damage_.push_back(cur.bounds());  // 새 위치 그리기
+}
+
+template<typename F>
+void View::update(F&& func) {
+  const auto start = std::chrono::steady_clock::now();
+  write_lock_guard lock(write_mutex());
+  recordWait(std::chrono::steady_clock::now() - start,
+             write_contentions_, write_wait_total_us_, write_wait_max_us_);
+  writes_.fetch_add(1, std::memory_order_relaxed);
+
+  func(state_);
+  if (state_.scene->needs_prepare())
+    state_.scene.write().prepare(); // 그리는 쪽에서 정렬하지 않도록 여기서 순서 갱신
+  frame_size_.store(packSize(state_.frame.size), std::memory_order_relaxed);
+  if (sync_mode_.load(std::memory_order_relaxed) == SyncMode::kSnapshot)
+    publishSnapshot();
+}
+
 } // namespace sample
 
 #endif // EYEDID_CPP_SAMPLE_VIEW_H_
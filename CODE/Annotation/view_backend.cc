@@ -0,0 +1,60 @@
+#include "view_backend.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace sample {
+
+// **WindowViewBackend 클래스**
+void WindowViewBackend::open(const std::string& name) {
+  cv::namedWindow(name); // OpenCV 윈도우 생성
+}
+
+void WindowViewBackend::close(const std::string& name) {
+  cv::destroyWindow(name); // OpenCV 윈도우 닫기
+}
+
+int WindowViewBackend::present(const std::string& name, const cv::Mat& image, int wait_ms) {
+  cv::imshow(name, image); // 화면을 윈도우에 표시
+  return cv::waitKey(std::max(wait_ms, 1)); // 주어진 시간(ms) 동안 키 입력 대기
+}
+
+int WindowViewBackend::poll(const std::string& name, int wait_ms) {
+  return cv::waitKey(std::max(wait_ms, 1)); // imshow 없이 창 이벤트와 키 입력만 처리
+}
+
+// **RenderSink 클래스**
+void ImageFileRenderSink::write(const cv::Mat& image) {
+  const auto index = count_++;
+  if (index % every_n_ != 0)
+    return;
+
+  char path[512];
+  std::snprintf(path, sizeof(path), pattern_.c_str(), static_cast<int>(index));
+  cv::imwrite(path, image);
+}
+
+void VideoFileRenderSink::write(const cv::Mat& image) {
+  if (!writer_.isOpened() && !writer_.open(path_, fourcc_, fps_, image.size()))
+    return;
+  writer_.write(image);
+}
+
+void StreamRenderSink::write(const cv::Mat& image) {
+  if (!cv::imencode(ext_, image, buffer_, params_))
+    return;
+
+  const auto size = static_cast<std::uint32_t>(buffer_.size());
+  stream_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  stream_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+  stream_.flush();
+}
+
+// **HeadlessViewBackend 클래스**
+int HeadlessViewBackend::present(const std::string& name, const cv::Mat& image, int wait_ms) {
+  sink_->write(image);
+  ++presented_;
+  return -1;
+}
+
+} // namespace sample
@@ -0,0 +1,149 @@
+#ifndef EYEDID_CPP_SAMPLE_VIEW_BACKEND_H_
+#define EYEDID_CPP_SAMPLE_VIEW_BACKEND_H_
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace sample {
+
+/**
+ * ViewBackend 클래스:
+ * - View가 그린 화면(cv::Mat)을 출력하는 방식의 추상 클래스
+ * - open()/close()/present()는 View::draw()를 호출하는 스레드(GUI 스레드)에서 호출됨
+ */
+class ViewBackend {
+ public:
+  virtual ~ViewBackend() = default;
+
+  virtual void open(const std::string& name) {}  // View 생성 시 호출
+  virtual void close(const std::string& name) {} // View::closeWindow() 시 호출
+
+  /**
+   * 화면 출력
+   * @param name    창 이름
+   * @param image   View가 그린 화면 (다음 draw()에서 덮어쓰므로 보관하려면 복사해야 함)
+   * @param wait_ms 키 입력 대기 시간 (0 이하이면 기다리지 않음)
+   * @return 눌린 키 값, 없으면 -1
+   */
+  virtual int present(const std::string& name, const cv::Mat& image, int wait_ms) = 0;
+
+  /**
+   * 화면이 바뀌지 않아 출력을 생략할 때 호출 (키 입력/창 이벤트만 처리)
+   * @return 눌린 키 값, 없으면 -1
+   */
+  virtual int poll(const std::string& name, int wait_ms) { return -1; }
+};
+
+/**
+ * WindowViewBackend 클래스:
+ * - OpenCV HighGUI 창에 출력 (기존 View 동작)
+ * - waitKey(0)은 무한히 기다리므로 wait_ms가 0 이하이면 1ms만 기다려 창 이벤트만 처리
+ */
+class WindowViewBackend : public ViewBackend {
+ public:
+  void open(const std::string& name) override;
+  void close(const std::string& name) override;
+  int present(const std::string& name, const cv::Mat& image, int wait_ms) override;
+  int poll(const std::string& name, int wait_ms) override;
+};
+
+/**
+ * RenderSink 클래스:
+ * - HeadlessViewBackend가 그린 화면을 전달받는 인터페이스
+ */
+class RenderSink {
+ public:
+  virtual ~RenderSink() = default;
+
+  virtual void write(const cv::Mat& image) = 0;
+};
+
+// 화면을 버림 (그리기 비용만 측정할 때 사용)
+class NullRenderSink : public RenderSink {
+ public:
+  void write(const cv::Mat& image) override {}
+};
+
+/**
+ * ImageFileRenderSink 클래스:
+ * - N 프레임마다 한 장씩 이미지 파일로 저장
+ * - pattern은 printf 형식으로 프레임 번호를 받음 (예: "view_%06d.png")
+ */
+class ImageFileRenderSink : public RenderSink {
+ public:
+  explicit ImageFileRenderSink(std::string pattern, int every_n = 1)
+  : pattern_(std::move(pattern)), every_n_(every_n > 0 ? every_n : 1) {}
+
+  void write(const cv::Mat& image) override;
+
+ private:
+  std::string pattern_;
+  int every_n_;
+  std::uint64_t count_ = 0;
+};
+
+/**
+ * VideoFileRenderSink 클래스:
+ * - cv::VideoWriter로 동영상 파일에 기록 (첫 프레임의 크기로 파일을 엶)
+ */
+class VideoFileRenderSink : public RenderSink {
+ public:
+  VideoFileRenderSink(std::string path, double fps, int fourcc = cv::VideoWriter::fourcc('M', 'J', 'P', 'G'))
+  : path_(std::move(path)), fps_(fps), fourcc_(fourcc) {}
+
+  void write(const cv::Mat& image) override;
+
+ private:
+  std::string path_;
+  double fps_;
+  int fourcc_;
+  cv::VideoWriter writer_;
+};
+
+/**
+ * StreamRenderSink 클래스:
+ * - 프레임을 이미지 형식(기본 JPEG)으로 인코딩하여 스트림에 이어서 기록
+ * - 각 프레임 앞에 바이트 수(uint32, 기기 바이트 순서)를 붙임 (파이프/소켓으로 다른 프로세스에 전달)
+ * - 인코딩 버퍼는 재사용하므로 크기가 비슷하면 프레임마다 할당이 없음
+ */
+class StreamRenderSink : public RenderSink {
+ public:
+  explicit StreamRenderSink(std::ostream& stream, std::string ext = ".jpg", int quality = 90)
+  : stream_(stream), ext_(std::move(ext)), params_{cv::IMWRITE_JPEG_QUALITY, quality} {}
+
+  void write(const cv::Mat& image) override;
+
+ private:
+  std::ostream& stream_;
+  std::string ext_;
+  std::vector<int> params_;
+  std::vector<std::uint8_t> buffer_;
+};
+
+/**
+ * HeadlessViewBackend 클래스:
+ * - 창 없이(X11/HighGUI 없이) 화면을 RenderSink로 전달
+ * - 키 입력이 없으므로 항상 -1을 반환하고, 기다리지도 않음 (그리기 주기는 FrameClock으로 조절)
+ */
+class HeadlessViewBackend : public ViewBackend {
+ public:
+  explicit HeadlessViewBackend(std::unique_ptr<RenderSink> sink = std::unique_ptr<RenderSink>(new NullRenderSink()))
+  : sink_(std::move(sink)) {}
+
+  int present(const std::string& name, const cv::Mat& image, int wait_ms) override;
+
+  std::uint64_t presented() const { return presented_; } // 출력한 프레임 수
+
+ private:
+  std::unique_ptr<RenderSink> sink_;
+  std::uint64_t presented_ = 0;
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_VIEW_BACKEND_H_
@@ -0,0 +1,88 @@
+#include "window_geometry.h"
+
+#include "eyedid/util/display.h" // 창 위치를 가져오기 위한 라이브러리
+
+namespace sample {
+
+constexpr std::chrono::milliseconds WindowGeometryCache::kDefaultRefreshInterval;
+
+WindowGeometryCache::WindowGeometryCache(std::chrono::milliseconds refresh_interval)
+: refresh_interval_ms_(refresh_interval.count()) {}
+
+bool WindowGeometryCache::refresh(const std::string& window_name) {
+  const auto now = clock::now();
+  const auto interval = std::chrono::milliseconds(refresh_interval_ms_.load(std::memory_order_relaxed));
+  if (!invalidated_.exchange(false) && now - last_refresh_ < interval)
+    return false;
+  last_refresh_ = now;
+
+  const auto rect = eyedid::getWindowRect(window_name);
+  refreshes_.fetch_add(1, std::memory_order_relaxed);
+
+  WindowGeometry geometry;
+  geometry.x = rect.x;
+  geometry.y = rect.y;
+  geometry.width = rect.width;
+  geometry.height = rect.height;
+  geometry.valid = true;
+  return store(geometry);
+}
+
+void WindowGeometryCache::invalidate() {
+  invalidations_.fetch_add(1, std::memory_order_relaxed);
+  invalidated_.store(true);
+}
+
+// 값이 바뀌었을 때만 seqlock으로 공개
+bool WindowGeometryCache::store(const WindowGeometry& geometry) {
+  if (geometry == current_)
+    return false;
+  current_ = geometry;
+
+  const auto seq = seq_.load(std::memory_order_relaxed);
+  seq_.store(seq + 1, std::memory_order_relaxed); // 작성 시작 (홀수)
+  std::atomic_thread_fence(std::memory_order_release);
+  x_.store(geometry.x, std::memory_order_relaxed);
+  y_.store(geometry.y, std::memory_order_relaxed);
+  width_.store(geometry.width, std::memory_order_relaxed);
+  height_.store(geometry.height, std::memory_order_relaxed);
+  valid_.store(geometry.valid, std::memory_order_relaxed);
+  seq_.store(seq + 2, std::memory_order_release); // 작성 끝 (짝수)
+
+  changes_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+// seq_가 짝수이고 읽는 동안 바뀌지 않았을 때의 값만 사용
+WindowGeometry WindowGeometryCache::load() const {
+  WindowGeometry geometry;
+  for (;;) {
+    const auto seq = seq_.load(std::memory_order_acquire);
+    if ((seq & 1) == 0) {
+      geometry.x = x_.load(std::memory_order_relaxed);
+      geometry.y = y_.load(std::memory_order_relaxed);
+      geometry.width = width_.load(std::memory_order_relaxed);
+      geometry.height = height_.load(std::memory_order_relaxed);
+      geometry.valid = valid_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) == seq)
+        return geometry;
+    }
+    read_retries_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void WindowGeometryCache::set_refresh_interval(std::chrono::milliseconds refresh_interval) {
+  refresh_interval_ms_.store(refresh_interval.count(), std::memory_order_relaxed);
+}
+
+WindowGeometryCache::Stats WindowGeometryCache::stats() const {
+  Stats stats;
+  stats.refreshes = refreshes_.load(std::memory_order_relaxed);
+  stats.changes = changes_.load(std::memory_order_relaxed);
+  stats.invalidations = invalidations_.load(std::memory_order_relaxed);
+  stats.read_retries = read_retries_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace sample
@@ -0,0 +1,95 @@
+#ifndef EYEDID_CPP_SAMPLE_WINDOW_GEOMETRY_H_
+#define EYEDID_CPP_SAMPLE_WINDOW_GEOMETRY_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace sample {
+
+// 창의 화면 좌표 (픽셀)
+struct WindowGeometry {
+  int x = 0;
+  int y = 0;
+  int width = 0;
+  int height = 0;
+  bool valid = false; // 한 번이라도 창 위치를 가져왔는지 여부
+
+  bool operator==(const WindowGeometry& other) const {
+    return x == other.x && y == other.y && width == other.width && height == other.height &&
+           valid == other.valid;
+  }
+  bool operator!=(const WindowGeometry& other) const { return !(*this == other); }
+};
+
+/**
+ * WindowGeometryCache 클래스:
+ * - 창의 위치와 크기를 캐시하여 추적 스레드가 시선마다 창 시스템을 호출하지 않도록 함
+ * - GUI 스레드가 refresh()로 창 위치를 확인하고, 바뀌었을 때만 새 값을 공개 (단일 작성자)
+ * - 추적 스레드는 load()로 잠금 없이 읽음 (seqlock: 작성 중이면 다시 읽음)
+ * - 창 시스템 호출은 refresh_interval마다 한 번으로 제한하며, invalidate() 후에는 바로 확인
+ */
+class WindowGeometryCache {
+ public:
+  // 캐시 통계
+  struct Stats {
+    std::uint64_t refreshes = 0;     // 창 시스템에서 위치를 가져온 횟수
+    std::uint64_t changes = 0;       // 위치나 크기가 바뀌어 새 값을 공개한 횟수
+    std::uint64_t invalidations = 0; // invalidate() 호출 수
+    std::uint64_t read_retries = 0;  // 작성 중이어서 다시 읽은 횟수
+  };
+
+  static constexpr std::chrono::milliseconds kDefaultRefreshInterval{200};
+
+  explicit WindowGeometryCache(std::chrono::milliseconds refresh_interval = kDefaultRefreshInterval);
+
+  /**
+   * 창 위치 확인 (GUI 스레드)
+   * - 마지막 확인 후 refresh_interval이 지났거나 invalidate()된 경우에만 창 시스템을 호출
+   * @param window_name 창 이름
+   * @return 새 값을 공개했으면 true
+   */
+  bool refresh(const std::string& window_name);
+
+  // 다음 refresh()에서 바로 창 위치를 확인하도록 함 (창을 옮기거나 크기를 바꾼 직후 등)
+  void invalidate();
+
+  // 창 위치 직접 설정 (GUI 스레드)
+  // @return 이전 값과 달라 새 값을 공개했으면 true
+  bool store(const WindowGeometry& geometry);
+
+  // 캐시된 창 위치 (어느 스레드에서나 호출 가능, 잠금 없음)
+  // - 시선마다 호출되므로 호출 수는 세지 않음 (공유 카운터를 쓰면 읽는 스레드끼리 캐시 라인을 주고받음)
+  WindowGeometry load() const;
+
+  void set_refresh_interval(std::chrono::milliseconds refresh_interval);
+
+  Stats stats() const;
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  // seqlock으로 보호되는 값 (홀수 seq_: 작성 중)
+  std::atomic<std::uint32_t> seq_{0};
+  std::atomic_int x_{0};
+  std::atomic_int y_{0};
+  std::atomic_int width_{0};
+  std::atomic_int height_{0};
+  std::atomic_bool valid_{false};
+
+  // GUI 스레드 전용
+  WindowGeometry current_;
+  clock::time_point last_refresh_;
+  std::atomic<std::int64_t> refresh_interval_ms_;
+  std::atomic_bool invalidated_{true};
+
+  std::atomic<std::uint64_t> refreshes_{0};
+  std::atomic<std::uint64_t> changes_{0};
+  std::atomic<std::uint64_t> invalidations_{0};
+  mutable std::atomic<std::uint64_t> read_retries_{0};
+};
+
+} // namespace sample
+
+#endif // EYEDID_CPP_SAMPLE_WINDOW_GEOMETRY_H_